@@ -635,6 +635,10 @@ SOURCE=.\src\base\io\ioReadVerilog.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\io\ioSession.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\io\ioUtil.c
 # End Source File
 # Begin Source File
@@ -1971,6 +1975,10 @@ SOURCE=.\src\sat\cnf\cnfPost.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\cnf\cnfStream.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\cnf\cnfUtil.c
 # End Source File
 # Begin Source File
@@ -2567,6 +2575,10 @@ SOURCE=.\src\opt\rwr\rwrExp.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\rwr\rwrGia.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\rwr\rwrLib.c
 # End Source File
 # Begin Source File
@@ -2977,6 +2989,10 @@ SOURCE=.\src\opt\dar\darResub.c
 
 SOURCE=.\src\opt\dar\darScript.c
 # End Source File
+# Begin Source File
+
+SOURCE=.\src\opt\dar\darWin.c
+# End Source File
 # End Group
 # Begin Group "rwt"
 
@@ -3175,6 +3191,10 @@ SOURCE=.\src\opt\sfm\sfmNtk.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\sfm\sfmPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\sfm\sfmSat.c
 # End Source File
 # Begin Source File
@@ -4859,6 +4879,10 @@ SOURCE=.\src\aig\gia\giaAigerExt.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaAigerStream.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaBalAig.c
 # End Source File
 # Begin Source File
@@ -5127,6 +5151,10 @@ SOURCE=.\src\aig\gia\giaResub3.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaRemap.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaRetime.c
 # End Source File
 # Begin Source File
@@ -5555,6 +5583,10 @@ SOURCE=.\src\proof\cec\cecPat.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\cec\cecProve.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\cec\cecSat.c
 # End Source File
 # Begin Source File
@@ -5915,6 +5947,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
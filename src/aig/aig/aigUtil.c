@@ -26,6 +26,16 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the state of the random number generator is kept per thread, so that
+// concurrent workers (for example, in scorr -J) reproduce sequential runs
+#if defined(ABC_USE_PTHREADS) && defined(_MSC_VER)
+#define AIG_THREAD_LOCAL __declspec(thread)
+#elif defined(ABC_USE_PTHREADS)
+#define AIG_THREAD_LOCAL __thread
+#else
+#define AIG_THREAD_LOCAL
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -1160,7 +1170,8 @@ void Aig_ManRandomTest1()
 
   Synopsis    [Creates a sequence of random numbers.]
 
-  Description []
+  Description [Each thread has its own sequence, which is restarted
+  when fReset is set.]
                
   SideEffects []
 
@@ -1169,8 +1180,8 @@ void Aig_ManRandomTest1()
 ***********************************************************************/
 unsigned Aig_ManRandom( int fReset )
 {
-    static unsigned int m_z = NUMBER1;
-    static unsigned int m_w = NUMBER2;
+    static AIG_THREAD_LOCAL unsigned int m_z = NUMBER1;
+    static AIG_THREAD_LOCAL unsigned int m_w = NUMBER2;
     if ( fReset )
     {
         m_z = NUMBER1;
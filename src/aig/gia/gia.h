@@ -53,6 +53,7 @@ typedef struct Gia_MmFixed_t_        Gia_MmFixed_t;
 typedef struct Gia_MmFlex_t_         Gia_MmFlex_t;     
 typedef struct Gia_MmStep_t_         Gia_MmStep_t;     
 typedef struct Gia_Dat_t_            Gia_Dat_t;
+typedef struct Gia_AigerStream_t_    Gia_AigerStream_t;
 
 typedef struct Gia_Rpr_t_ Gia_Rpr_t;
 struct Gia_Rpr_t_
@@ -1238,12 +1239,26 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern char *              Gia_AigerMapFile( char * pFileName, int * pnFileSize );
+extern void                Gia_AigerUnmapFile( char * pContents, int nFileSize );
+extern void                Gia_AigerSetProcs( int nProcs );
+extern int                 Gia_AigerReadProcs();
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
+extern void                Gia_AigerWriteStream( Gia_Man_t * p, Gia_AigerStream_t * pFile, int fWriteSymbols, int fCompact, int fWriteNewLine );
+extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStrAll( Gia_Man_t * p );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vAnds, Vec_Int_t * vCos, int nRegs );
 extern void                Gia_AigerWriteSimple( Gia_Man_t * pInit, char * pFileName );
+/*=== giaAigerStream.c ===========================================================*/
+extern Gia_AigerStream_t * Gia_AigerStreamOpen( char * pFileName, int nProcs );
+extern Gia_AigerStream_t * Gia_AigerStreamOpenStr( Vec_Str_t * vOut );
+extern void                Gia_AigerStreamWrite( Gia_AigerStream_t * p, char * pData, int nSize );
+extern void                Gia_AigerStreamWriteInt( Gia_AigerStream_t * p, int Value );
+extern void                Gia_AigerStreamPrintf( Gia_AigerStream_t * p, const char * pFormat, ... );
+extern int                 Gia_AigerStreamClose( Gia_AigerStream_t * p );
+extern char *              Gia_AigerStreamReadGz( char * pFileName, int * pnFileSize );
 /*=== giaBalance.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManBalance( Gia_Man_t * p, int fSimpleAnd, int fStrict, int fVerbose );
 extern Gia_Man_t *         Gia_ManAreaBalance( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax, int fVerbose, int fVeryVerbose );
@@ -1548,6 +1563,10 @@ extern Gia_Man_t *         Gia_ManDupMuxes( Gia_Man_t * p, int Limit );
 extern Gia_Man_t *         Gia_ManDupNoMuxes( Gia_Man_t * p, int fSkipBufs );
 /*=== giaPat.c ===========================================================*/
 extern void                Gia_SatVerifyPattern( Gia_Man_t * p, Gia_Obj_t * pRoot, Vec_Int_t * vCex, Vec_Int_t * vVisit );
+/*=== giaRemap.c ===========================================================*/
+extern Vec_Int_t *         Gia_ManMappingCollectBroken( Gia_Man_t * p );
+extern int                 Gia_ManMappingIncremental( Gia_Man_t * p, Vec_Int_t * vChanged, int nLutSize, int fVerbose );
+extern int                 Gia_ManMappingIncrementalTest( Gia_Man_t * p, int nRemove, int nLutSize, int fVerbose );
 /*=== giaRetime.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManRetimeForward( Gia_Man_t * p, int nMaxIters, int fVerbose );
 /*=== giaSat.c ============================================================*/
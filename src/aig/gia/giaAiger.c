@@ -21,8 +21,26 @@
 
 #include "gia.h"
 #include "misc/tim/tim.h"
+#include "misc/util/utilTruth.h"
 #include "base/main/main.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
@@ -31,6 +49,28 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define GIA_AIGER_THR_MAX    64         // the max number of threads
+#define GIA_AIGER_CHUNK_MIN  100000     // the min number of AND gates per thread
+#define GIA_AIGER_RANGE      (1 << 20)  // the number of objects encoded at a time by the writer
+
+// the number of threads used to decode/encode AND gates
+static int s_nAigerProcs = 1;
+
+// information given to the thread
+typedef struct Gia_AigerThData_t_ Gia_AigerThData_t;
+struct Gia_AigerThData_t_
+{
+    Gia_Man_t *     p;            // the manager (decoding without strashing or encoding)
+    unsigned char * pStart;       // the first byte of the chunk (decoding)
+    int *           pLits;        // the fanin literals (decoding with strashing)
+    int             nCis;         // the number of CIs (decoding)
+    int             nBufs;        // the number of buffers (decoding)
+    int             fUseValues;   // use the values as AIGER variables (encoding)
+    Vec_Str_t *     vStr;         // the resulting buffer (encoding)
+    int             iStart;       // the first AND gate or object
+    int             iStop;        // the last AND gate or object plus one
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -162,6 +202,254 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
     return vBinary;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Sets the number of threads used to decode/encode AND gates.]
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerSetProcs( int nProcs )
+{
+    s_nAigerProcs = Abc_MaxInt( 1, Abc_MinInt(nProcs, GIA_AIGER_THR_MAX) );
+}
+int Gia_AigerReadProcs()
+{
+    return s_nAigerProcs;
+}
+static inline int Gia_AigerProcsForAnds( int nAnds )
+{
+    return Abc_MaxInt( 1, Abc_MinInt(s_nAigerProcs, nAnds / GIA_AIGER_CHUNK_MIN) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes or encodes one chunk of AND gates.]
+
+  Description [When decoding, the deltas are relative to the AIGER variable 
+  of the gate itself, so a chunk can be decoded independently once its 
+  first byte is known. If the manager is given, the gates are written 
+  directly into its (already allocated) objects, which is possible when 
+  structural hashing is not used because AIGER variables are then equal 
+  to object IDs. Otherwise, the fanin literals are saved in the array.
+  When encoding, the AND gates among the objects in the given range are 
+  written into the chunk's own buffer.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerDecodeChunk( Gia_AigerThData_t * pThData )
+{
+    unsigned char * pCur = pThData->pStart;
+    unsigned uLit, uLit0, uLit1;
+    int i;
+    for ( i = pThData->iStart; i < pThData->iStop; i++ )
+    {
+        uLit  = ((i + 1 + pThData->nCis) << 1);
+        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( pThData->p )
+        {
+            Gia_Obj_t * pObj = Gia_ManObj( pThData->p, uLit >> 1 );
+            assert( uLit0 <= uLit1 && uLit1 < uLit );
+            pObj->iDiff0  = (uLit >> 1) - (uLit0 >> 1);
+            pObj->fCompl0 = uLit0 & 1;
+            pObj->iDiff1  = (uLit >> 1) - (uLit1 >> 1);
+            pObj->fCompl1 = uLit1 & 1;
+            pThData->nBufs += (uLit0 == uLit1);
+        }
+        else
+        {
+            pThData->pLits[2*i+0] = uLit0;
+            pThData->pLits[2*i+1] = uLit1;
+        }
+    }
+}
+void Gia_AigerEncodeChunk( Gia_AigerThData_t * pThData )
+{
+    Gia_Man_t * p = pThData->p;
+    Gia_Obj_t * pObj;
+    unsigned uLit, uLit0, uLit1, Temp;
+    int i;
+    for ( i = pThData->iStart; i < pThData->iStop; i++ )
+    {
+        pObj = Gia_ManObj( p, i );
+        if ( !Gia_ObjIsAnd(pObj) )
+            continue;
+        if ( pThData->fUseValues )
+        {
+            uLit  = Abc_Var2Lit( Gia_ObjValue(pObj), 0 );
+            uLit0 = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
+            uLit1 = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin1(pObj)), Gia_ObjFaninC1(pObj) );
+        }
+        else
+        {
+            uLit  = Abc_Var2Lit( i, 0 );
+            uLit0 = Gia_ObjFaninLit0( pObj, i );
+            uLit1 = Gia_ObjFaninLit1( pObj, i );
+        }
+        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 != uLit1 );
+        if ( uLit0 > uLit1 )
+            Temp = uLit0, uLit0 = uLit1, uLit1 = Temp;
+        Gia_AigerWriteUnsigned( pThData->vStr, uLit  - uLit1 );
+        Gia_AigerWriteUnsigned( pThData->vStr, uLit1 - uLit0 );
+    }
+}
+
+#ifdef ABC_USE_PTHREADS
+
+void * Gia_AigerWorkerThread( void * pArg )
+{
+    Gia_AigerThData_t * pThData = (Gia_AigerThData_t *)pArg;
+    if ( pThData->vStr )
+        Gia_AigerEncodeChunk( pThData );
+    else
+        Gia_AigerDecodeChunk( pThData );
+    pthread_exit( NULL );
+    assert(0);
+    return NULL;
+}
+void Gia_AigerRunWorkers( Gia_AigerThData_t * pThData, int nProcs )
+{
+    pthread_t WorkerThread[GIA_AIGER_THR_MAX];
+    int i, status;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Gia_AigerWorkerThread, (void *)(pThData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+}
+
+#else
+
+void Gia_AigerRunWorkers( Gia_AigerThData_t * pThData, int nProcs )
+{
+    int i;
+    for ( i = 0; i < nProcs; i++ )
+        if ( pThData[i].vStr )
+            Gia_AigerEncodeChunk( pThData + i );
+        else
+            Gia_AigerDecodeChunk( pThData + i );
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes the AND gates using concurrent threads.]
+
+  Description [The pre-pass finds the first byte of each chunk by counting 
+  the last bytes of the varints (those without the high bit), eight bytes 
+  at a time where possible. Moves the pointer to the end of the section.
+  Returns the array of fanin literals (two per gate) if the manager is not 
+  given; otherwise, returns NULL.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int * Gia_AigerDecodeAndsPar( unsigned char ** ppCur, unsigned char * pEnd, int nAnds, int nCis, Gia_Man_t * pNew, int nProcs )
+{
+    Gia_AigerThData_t ThData[GIA_AIGER_THR_MAX];
+    unsigned char * pCur = *ppCur;
+    int * pLits = pNew ? NULL : ABC_ALLOC( int, 2 * nAnds );
+    int i, nVarints = 0, nChunk = (nAnds + nProcs - 1) / nProcs;
+    assert( nProcs > 1 && nProcs <= GIA_AIGER_THR_MAX );
+    memset( ThData, 0, sizeof(Gia_AigerThData_t) * nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        int nVarintsStop = 2 * Abc_MinInt( (i + 1) * nChunk, nAnds );
+        ThData[i].p      = pNew;
+        ThData[i].pLits  = pLits;
+        ThData[i].nCis   = nCis;
+        ThData[i].iStart = Abc_MinInt( i * nChunk, nAnds );
+        ThData[i].iStop  = Abc_MinInt( (i + 1) * nChunk, nAnds );
+        ThData[i].pStart = pCur;
+        // skip the varints of this chunk
+        while ( nVarints + 8 < nVarintsStop && pCur + 8 <= pEnd )
+        {
+            word Word; 
+            memcpy( &Word, pCur, 8 );
+            nVarints += Abc_TtCountOnes( ~Word & ABC_CONST(0x8080808080808080) );
+            pCur += 8;
+        }
+        while ( nVarints < nVarintsStop )
+            nVarints += (*pCur++ < 0x80);
+    }
+    assert( nVarints == 2 * nAnds );
+    if ( pNew )
+    {
+        assert( Gia_ManObjNum(pNew) == 1 + nCis );
+        assert( pNew->nObjsAlloc >= 1 + nCis + nAnds );
+        pNew->nObjs += nAnds;
+    }
+    Gia_AigerRunWorkers( ThData, nProcs );
+    if ( pNew )
+        for ( i = 0; i < nProcs; i++ )
+            pNew->nBufs += ThData[i].nBufs;
+    *ppCur = pCur;
+    return pLits;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Encodes the AND gates into the buffer.]
+
+  Description [If fUseValues is set, the AIGER variables are taken from 
+  the Value fields of the objects; otherwise, the AIG should be normalized
+  and object IDs are used. Only objects in the range [iBeg, iEnd) are 
+  encoded. With several threads, each of them encodes a part of the range
+  into its own buffer and the buffers are appended in order, which results
+  in the same output as the serial encoding.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerEncodeAndsRange( Gia_Man_t * p, int fUseValues, int iBeg, int iEnd, Vec_Str_t * vBuffer )
+{
+    Gia_AigerThData_t ThData[GIA_AIGER_THR_MAX];
+    int i, nProcs = Gia_AigerProcsForAnds( iEnd - iBeg );
+    int nChunk = (iEnd - iBeg + nProcs - 1) / nProcs;
+    memset( ThData, 0, sizeof(Gia_AigerThData_t) * nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].p          = p;
+        ThData[i].fUseValues = fUseValues;
+        ThData[i].iStart     = Abc_MinInt( iBeg + i * nChunk, iEnd );
+        ThData[i].iStop      = Abc_MinInt( iBeg + (i + 1) * nChunk, iEnd );
+        ThData[i].vStr       = nProcs == 1 ? vBuffer : Vec_StrAlloc( 3 * (ThData[i].iStop - ThData[i].iStart) + 16 );
+    }
+    if ( nProcs == 1 )
+    {
+        Gia_AigerEncodeChunk( ThData );
+        return;
+    }
+    Gia_AigerRunWorkers( ThData, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Vec_StrPushBuffer( vBuffer, Vec_StrArray(ThData[i].vStr), Vec_StrSize(ThData[i].vStr) );
+        Vec_StrFree( ThData[i].vStr );
+    }
+}
+void Gia_AigerEncodeAnds( Gia_Man_t * p, int fUseValues, Vec_Str_t * vBuffer )
+{
+    Gia_AigerEncodeAndsRange( p, fUseValues, 0, Gia_ManObjNum(p), vBuffer );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
@@ -180,7 +468,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
     Vec_Int_t * vNodes, * vDrivers, * vInits = NULL;
     int iObj, iNode0, iNode1, fHieOnly = 0;
-    int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
+    int nTotal, nInputs, nOutputs, nLatches, nAnds, nProcs, i;
     int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
     unsigned char * pDrivers, * pSymbols, * pCur;
     unsigned uLit0, uLit1, uLit;
@@ -284,29 +572,54 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
 
     // create the AND gates
-    if ( !fGiaSimple && !fSkipStrash )
-        Gia_ManHashAlloc( pNew );
-    for ( i = 0; i < nAnds; i++ )
+    nProcs = Gia_AigerProcsForAnds( nAnds );
+    if ( !fGiaSimple && fSkipStrash )
     {
-        uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
-//        assert( uLit1 > uLit0 );
-        iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
-        iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
-        assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
-        if ( !fGiaSimple && fSkipStrash )
+        // without hashing, AIGER variables are object IDs and literals are used as they are
+        if ( nProcs > 1 )
+            Gia_AigerDecodeAndsPar( &pCur, (unsigned char *)pContents + nFileSize, nAnds, nInputs + nLatches, pNew, nProcs );
+        else for ( i = 0; i < nAnds; i++ )
         {
-            if ( iNode0 == iNode1 )
-                Vec_IntPush( vNodes, Gia_ManAppendBuf(pNew, iNode0) );
+            uLit = ((i + 1 + nInputs + nLatches) << 1);
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+            if ( uLit0 == uLit1 )
+                Gia_ManAppendBuf( pNew, uLit0 );
             else
-                Vec_IntPush( vNodes, Gia_ManAppendAnd(pNew, iNode0, iNode1) );
+                Gia_ManAppendAnd( pNew, uLit0, uLit1 );
         }
-        else
+        assert( Gia_ManObjNum(pNew) == 1 + nTotal );
+        for ( i = 1 + nInputs + nLatches; i <= nTotal; i++ )
+            Vec_IntPush( vNodes, Abc_Var2Lit(i, 0) );
+    }
+    else
+    {
+        int * pLits = nProcs > 1 ? Gia_AigerDecodeAndsPar( &pCur, (unsigned char *)pContents + nFileSize, nAnds, nInputs + nLatches, NULL, nProcs ) : NULL;
+        if ( !fGiaSimple )
+            Gia_ManHashAlloc( pNew );
+        for ( i = 0; i < nAnds; i++ )
+        {
+            if ( pLits )
+            {
+                uLit0 = pLits[2*i+0];
+                uLit1 = pLits[2*i+1];
+            }
+            else
+            {
+                uLit = ((i + 1 + nInputs + nLatches) << 1);
+                uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+                uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+            }
+//            assert( uLit1 > uLit0 );
+            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
+            iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
+            assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
             Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
+        }
+        if ( !fGiaSimple )
+            Gia_ManHashStop( pNew );
+        ABC_FREE( pLits );
     }
-    if ( !fGiaSimple && !fSkipStrash )
-        Gia_ManHashStop( pNew );
 
     // remember the place where symbols begin
     pSymbols = pCur;
@@ -1000,11 +1313,64 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [Returns a private copy-on-write mapping of the file, so that
+  the reader can decode it in place without copying it into the heap and
+  can still overwrite bytes (for example, when terminating signal names).
+  Returns NULL if the file cannot be mapped or if its size is a multiple of 
+  the page size (the reader may then look one byte past the end of the file, 
+  which is only safe when the last page is not full); in this case, the 
+  file should be read into a buffer.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_AigerMapFile( char * pFileName, int * pnFileSize )
+{
+#ifndef _WIN32
+    struct stat Stat;
+    char * pContents;
+    long nPageSize = sysconf( _SC_PAGESIZE );
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd < 0 )
+        return NULL;
+    if ( fstat( fd, &Stat ) != 0 || Stat.st_size == 0 || Stat.st_size >= 0x7FFFFFFF || 
+         nPageSize <= 0 || Stat.st_size % nPageSize == 0 )
+    {
+        close( fd );
+        return NULL;
+    }
+    pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return NULL;
+#ifdef MADV_SEQUENTIAL
+    madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+#endif
+    *pnFileSize = (int)Stat.st_size;
+    return pContents;
+#else
+    return NULL;
+#endif
+}
+void Gia_AigerUnmapFile( char * pContents, int nFileSize )
+{
+#ifndef _WIN32
+    munmap( pContents, (size_t)nFileSize );
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
 
-  Description []
+  Description [The file is decoded directly from its memory mapping when 
+  the platform supports it; otherwise, it is first read into a buffer.]
   
   SideEffects []
 
@@ -1019,16 +1385,35 @@ Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, in
     int nFileSize;
     int RetValue;
 
-    // read the file into the buffer
+    // map the file or read it into the buffer
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
+    if ( strlen(pFileName) > 3 && !strcmp(pFileName + strlen(pFileName) - 3, ".gz") )
+    {
+        pContents = Gia_AigerStreamReadGz( pFileName, &nFileSize );
+        if ( pContents == NULL )
+        {
+            printf( "Gia_AigerRead(): Cannot read the compressed file \"%s\".\n", pFileName );
+            return NULL;
+        }
+        pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+        ABC_FREE( pContents );
+    }
+    else if ( (pContents = Gia_AigerMapFile( pFileName, &nFileSize )) )
+    {
+        pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+        Gia_AigerUnmapFile( pContents, nFileSize );
+    }
+    else
+    {
+        nFileSize = Gia_FileSize( pFileName );
+        pFile = fopen( pFileName, "rb" );
+        pContents = ABC_ALLOC( char, nFileSize );
+        RetValue = fread( pContents, nFileSize, 1, pFile );
+        fclose( pFile );
 
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+        pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+        ABC_FREE( pContents );
+    }
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
@@ -1060,7 +1445,7 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p )
 {
     Vec_Str_t * vBuffer;
     Gia_Obj_t * pObj;
-    int nNodes = 0, i, uLit, uLit0, uLit1; 
+    int nNodes = 0, i, uLit; 
     // set the node numbers to be used in the output file
     Gia_ManConst0(p)->Value = nNodes++;
     Gia_ManForEachCi( p, pObj, i )
@@ -1098,21 +1483,7 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p )
         Vec_StrPrintStr( vBuffer, "\n" );
     }
     // write the nodes into the buffer
-    Gia_ManForEachAnd( p, pObj, i )
-    {
-        uLit  = Abc_Var2Lit( Gia_ObjValue(pObj), 0 );
-        uLit0 = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
-        uLit1 = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin1(pObj)), Gia_ObjFaninC1(pObj) );
-        assert( uLit0 != uLit1 );
-        if ( uLit0 > uLit1 )
-        {
-            int Temp = uLit0;
-            uLit0 = uLit1;
-            uLit1 = Temp;
-        }
-        Gia_AigerWriteUnsigned( vBuffer, uLit  - uLit1 );
-        Gia_AigerWriteUnsigned( vBuffer, uLit1 - uLit0 );
-    }
+    Gia_AigerEncodeAnds( p, 1, vBuffer );
     Vec_StrPrintStr( vBuffer, "c" );
     return vBuffer;
 }
@@ -1214,32 +1585,15 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine )
+void Gia_AigerWriteStream( Gia_Man_t * pInit, Gia_AigerStream_t * pFile, int fWriteSymbols, int fCompact, int fWriteNewLine )
 {
     int fVerbose = XAIG_VERBOSE;
-    FILE * pFile;
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
     Vec_Str_t * vStrExt;
-    int i, nBufferSize, Pos;
-    unsigned char * pBuffer;
-    unsigned uLit0, uLit1, uLit;
+    int i, iBeg;
     assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
 
-    if ( Gia_ManCoNum(pInit) == 0 )
-    {
-        printf( "AIG cannot be written because it has no POs.\n" );
-        return;
-    }
-
-    // start the output stream
-    pFile = fopen( pFileName, "wb" );
-    if ( pFile == NULL )
-    {
-        fprintf( stdout, "Gia_AigerWrite(): Cannot open the output file \"%s\".\n", pFileName );
-        return;
-    }
-
     // create normalized AIG
     if ( !Gia_ManIsNormalized(pInit) )
     {
@@ -1254,7 +1608,7 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         p = pInit;
 
     // write the header "M I L O A" where M = I + L + A
-    fprintf( pFile, "aig%s %u %u %u %u %u", 
+    Gia_AigerStreamPrintf( pFile, "aig%s %u %u %u %u %u", 
         fCompact? "2" : "",
         Gia_ManCiNum(p) + Gia_ManAndNum(p), 
         Gia_ManPiNum(p),
@@ -1263,55 +1617,39 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         Gia_ManAndNum(p) );
     // write the extended header "B C J F"
     if ( Gia_ManConstrNum(p) )
-        fprintf( pFile, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
-    fprintf( pFile, "\n" ); 
+        Gia_AigerStreamPrintf( pFile, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
+    Gia_AigerStreamPrintf( pFile, "\n" ); 
 
     Gia_ManInvertConstraints( p );
     if ( !fCompact ) 
     {
         // write latch drivers
         Gia_ManForEachRi( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerStreamPrintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
         // write PO drivers
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerStreamPrintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
     }
     else
     {
         Vec_Int_t * vLits = Gia_AigerCollectLiterals( p );
         Vec_Str_t * vBinary = Gia_AigerWriteLiterals( vLits );
-        fwrite( Vec_StrArray(vBinary), 1, Vec_StrSize(vBinary), pFile );
+        Gia_AigerStreamWrite( pFile, Vec_StrArray(vBinary), Vec_StrSize(vBinary) );
         Vec_StrFree( vBinary );
         Vec_IntFree( vLits );
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
-    Gia_ManForEachAnd( p, pObj, i )
+    // write the nodes in bounded ranges, so that the buffer does not grow
+    // with the AIG and the stream compresses one range while the next is encoded
+    vStrExt = Vec_StrAlloc( 3 * GIA_AIGER_RANGE + 100 );
+    for ( iBeg = 0; iBeg < Gia_ManObjNum(p); iBeg += GIA_AIGER_RANGE )
     {
-        uLit  = Abc_Var2Lit( i, 0 );
-        uLit0 = Gia_ObjFaninLit0( pObj, i );
-        uLit1 = Gia_ObjFaninLit1( pObj, i );
-        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
-        {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
-        }
+        Vec_StrClear( vStrExt );
+        Gia_AigerEncodeAndsRange( p, 0, iBeg, Abc_MinInt(iBeg + GIA_AIGER_RANGE, Gia_ManObjNum(p)), vStrExt );
+        Gia_AigerStreamWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
     }
-    assert( Pos < nBufferSize );
-
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
+    Vec_StrFree( vStrExt );
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1320,13 +1658,13 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         assert( Vec_PtrSize(p->vNamesOut) == Gia_ManCoNum(p) );
         // write PIs
         Gia_ManForEachPi( p, pObj, i )
-            fprintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
+            Gia_AigerStreamPrintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
         // write latches
         Gia_ManForEachRo( p, pObj, i )
-            fprintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
+            Gia_AigerStreamPrintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
         // write POs
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
+            Gia_AigerStreamPrintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
     }
     if ( p->vNamesNode && Vec_PtrSize(p->vNamesNode) != Gia_ManObjNum(p) )
         Abc_Print( 0, "The size of the node name array does not match the number of objects. Names are not written.\n" );
@@ -1334,38 +1672,38 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     {
         Gia_ManForEachAnd( p, pObj, i )
             if ( Vec_PtrEntry(p->vNamesNode, i) )
-                fprintf( pFile, "n%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesNode, i) );
+                Gia_AigerStreamPrintf( pFile, "n%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesNode, i) );
     }
 
     // write the comment
     if ( fWriteNewLine ) 
-        fprintf( pFile, "c\n" );
+        Gia_AigerStreamPrintf( pFile, "c\n" );
     else
-        fprintf( pFile, "c" );
+        Gia_AigerStreamPrintf( pFile, "c" );
 
     // write additional AIG
     if ( p->pAigExtra )
     {
-        fprintf( pFile, "a" );
+        Gia_AigerStreamPrintf( pFile, "a" );
         vStrExt = Gia_AigerWriteIntoMemoryStr( p->pAigExtra );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerStreamWriteInt( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerStreamWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"a\".\n" );
     }
     // write constraints
     if ( p->nConstrs )
     {
-        fprintf( pFile, "c" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nConstrs );
+        Gia_AigerStreamPrintf( pFile, "c" );
+        Gia_AigerStreamWriteInt( pFile, 4 );
+        Gia_AigerStreamWriteInt( pFile, p->nConstrs );
     }
     // write timing information
     if ( p->nAnd2Delay )
     {
-        fprintf( pFile, "d" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nAnd2Delay );
+        Gia_AigerStreamPrintf( pFile, "d" );
+        Gia_AigerStreamWriteInt( pFile, 4 );
+        Gia_AigerStreamWriteInt( pFile, p->nAnd2Delay );
     }
     if ( p->pManTime )
     {
@@ -1373,18 +1711,18 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         pTimes = Tim_ManGetArrTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "i" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerStreamPrintf( pFile, "i" );
+            Gia_AigerStreamWriteInt( pFile, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerStreamWrite( pFile, (char *)pTimes, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"i\".\n" );
         }
         pTimes = Tim_ManGetReqTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "o" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerStreamPrintf( pFile, "o" );
+            Gia_AigerStreamWriteInt( pFile, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerStreamWrite( pFile, (char *)pTimes, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"o\".\n" );
         }
@@ -1393,35 +1731,35 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     if ( p->pReprs && p->pNexts )
     {
         extern Vec_Str_t * Gia_WriteEquivClasses( Gia_Man_t * p );
-        fprintf( pFile, "e" );
+        Gia_AigerStreamPrintf( pFile, "e" );
         vStrExt = Gia_WriteEquivClasses( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerStreamWriteInt( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerStreamWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
     // write flop classes
     if ( p->vFlopClasses )
     {
-        fprintf( pFile, "f" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManRegNum(p) );
+        Gia_AigerStreamPrintf( pFile, "f" );
+        Gia_AigerStreamWriteInt( pFile, 4*Gia_ManRegNum(p) );
         assert( Vec_IntSize(p->vFlopClasses) == Gia_ManRegNum(p) );
-        fwrite( Vec_IntArray(p->vFlopClasses), 1, 4*Gia_ManRegNum(p), pFile );
+        Gia_AigerStreamWrite( pFile, (char *)Vec_IntArray(p->vFlopClasses), 4*Gia_ManRegNum(p) );
     }
     // write gate classes
     if ( p->vGateClasses )
     {
-        fprintf( pFile, "g" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerStreamPrintf( pFile, "g" );
+        Gia_AigerStreamWriteInt( pFile, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vGateClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vGateClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerStreamWrite( pFile, (char *)Vec_IntArray(p->vGateClasses), 4*Gia_ManObjNum(p) );
     }
     // write hierarchy info
     if ( p->pManTime )
     {
-        fprintf( pFile, "h" );
+        Gia_AigerStreamPrintf( pFile, "h" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 1 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerStreamWriteInt( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerStreamWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"h\".\n" );
     }
@@ -1429,10 +1767,10 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     if ( p->vPacking )
     {
         extern Vec_Str_t * Gia_WritePacking( Vec_Int_t * vPacking );
-        fprintf( pFile, "k" );
+        Gia_AigerStreamPrintf( pFile, "k" );
         vStrExt = Gia_WritePacking( p->vPacking );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerStreamWriteInt( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerStreamWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"k\".\n" );
     }
@@ -1441,11 +1779,11 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     {
         Vec_Int_t * vPairs = Gia_ManEdgeToArray( p );
         int i;
-        fprintf( pFile, "w" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(vPairs)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(vPairs)/2 );
+        Gia_AigerStreamPrintf( pFile, "w" );
+        Gia_AigerStreamWriteInt( pFile, 4*(Vec_IntSize(vPairs)+1) );
+        Gia_AigerStreamWriteInt( pFile, Vec_IntSize(vPairs)/2 );
         for ( i = 0; i < Vec_IntSize(vPairs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(vPairs, i) );
+            Gia_AigerStreamWriteInt( pFile, Vec_IntEntry(vPairs, i) );
         Vec_IntFree( vPairs );
     }
     // write mapping
@@ -1454,115 +1792,155 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         extern Vec_Str_t * Gia_AigerWriteMapping( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingSimple( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingDoc( Gia_Man_t * p );
-        fprintf( pFile, "m" );
+        Gia_AigerStreamPrintf( pFile, "m" );
         vStrExt = Gia_AigerWriteMappingDoc( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerStreamWriteInt( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerStreamWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"m\".\n" );
     }
     // write placement
     if ( p->pPlacement )
     {
-        fprintf( pFile, "p" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
-        fwrite( p->pPlacement, 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerStreamPrintf( pFile, "p" );
+        Gia_AigerStreamWriteInt( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerStreamWrite( pFile, (char *)p->pPlacement, 4*Gia_ManObjNum(p) );
     }
     // write register classes
     if ( p->vRegClasses )
     {
         int i;
-        fprintf( pFile, "r" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegClasses)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegClasses) );
+        Gia_AigerStreamPrintf( pFile, "r" );
+        Gia_AigerStreamWriteInt( pFile, 4*(Vec_IntSize(p->vRegClasses)+1) );
+        Gia_AigerStreamWriteInt( pFile, Vec_IntSize(p->vRegClasses) );
         for ( i = 0; i < Vec_IntSize(p->vRegClasses); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegClasses, i) );
+            Gia_AigerStreamWriteInt( pFile, Vec_IntEntry(p->vRegClasses, i) );
     }
     // write register inits
     if ( p->vRegInits )
     {
         int i;
-        fprintf( pFile, "s" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegInits)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegInits) );
+        Gia_AigerStreamPrintf( pFile, "s" );
+        Gia_AigerStreamWriteInt( pFile, 4*(Vec_IntSize(p->vRegInits)+1) );
+        Gia_AigerStreamWriteInt( pFile, Vec_IntSize(p->vRegInits) );
         for ( i = 0; i < Vec_IntSize(p->vRegInits); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegInits, i) );
+            Gia_AigerStreamWriteInt( pFile, Vec_IntEntry(p->vRegInits, i) );
     }
     // write configuration data
     if ( p->vConfigs )
     {
-        fprintf( pFile, "b" );
+        Gia_AigerStreamPrintf( pFile, "b" );
         assert( p->pCellStr != NULL );
-        Gia_FileWriteBufferSize( pFile, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
-        fwrite( p->pCellStr, 1, strlen(p->pCellStr) + 1, pFile );
-//        fwrite( Vec_IntArray(p->vConfigs), 1, 4*Vec_IntSize(p->vConfigs), pFile );
+        Gia_AigerStreamWriteInt( pFile, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
+        Gia_AigerStreamWrite( pFile, p->pCellStr, strlen(p->pCellStr) + 1 );
+//        Gia_AigerStreamWrite( pFile, (char *)Vec_IntArray(p->vConfigs), 4*Vec_IntSize(p->vConfigs) );
         for ( i = 0; i < Vec_IntSize(p->vConfigs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vConfigs, i) );
+            Gia_AigerStreamWriteInt( pFile, Vec_IntEntry(p->vConfigs, i) );
     }
     // write choices
     if ( Gia_ManHasChoices(p) )
     {
         int i, nPairs = 0;
-        fprintf( pFile, "q" );
+        Gia_AigerStreamPrintf( pFile, "q" );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             nPairs += (Gia_ObjSibl(p, i) > 0);
-        Gia_FileWriteBufferSize( pFile, 4*(nPairs * 2 + 1) );
-        Gia_FileWriteBufferSize( pFile, nPairs );
+        Gia_AigerStreamWriteInt( pFile, 4*(nPairs * 2 + 1) );
+        Gia_AigerStreamWriteInt( pFile, nPairs );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             if ( Gia_ObjSibl(p, i) )
             {
                 assert( i > Gia_ObjSibl(p, i) );
-                Gia_FileWriteBufferSize( pFile, i );
-                Gia_FileWriteBufferSize( pFile, Gia_ObjSibl(p, i) );
+                Gia_AigerStreamWriteInt( pFile, i );
+                Gia_AigerStreamWriteInt( pFile, Gia_ObjSibl(p, i) );
             }
         if ( fVerbose ) printf( "Finished writing extension \"q\".\n" );
     }
     // write switching activity
     if ( p->pSwitching )
     {
-        fprintf( pFile, "u" );
-        Gia_FileWriteBufferSize( pFile, Gia_ManObjNum(p) );
-        fwrite( p->pSwitching, 1, Gia_ManObjNum(p), pFile );
+        Gia_AigerStreamPrintf( pFile, "u" );
+        Gia_AigerStreamWriteInt( pFile, Gia_ManObjNum(p) );
+        Gia_AigerStreamWrite( pFile, (char *)p->pSwitching, Gia_ManObjNum(p) );
     }
 /*
     // write timing information
     if ( p->pManTime )
     {
-        fprintf( pFile, "t" );
+        Gia_AigerStreamPrintf( pFile, "t" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 0 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerStreamWriteInt( pFile, Vec_StrSize(vStrExt) );
+        Gia_AigerStreamWrite( pFile, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
 */
     // write object classes
     if ( p->vObjClasses )
     {
-        fprintf( pFile, "v" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerStreamPrintf( pFile, "v" );
+        Gia_AigerStreamWriteInt( pFile, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vObjClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vObjClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerStreamWrite( pFile, (char *)Vec_IntArray(p->vObjClasses), 4*Gia_ManObjNum(p) );
     }
     // write name
     if ( p->pName )
     {
-        fprintf( pFile, "n" );
-        Gia_FileWriteBufferSize( pFile, strlen(p->pName)+1 );
-        fwrite( p->pName, 1, strlen(p->pName), pFile );
-        fprintf( pFile, "%c", '\0' );
+        Gia_AigerStreamPrintf( pFile, "n" );
+        Gia_AigerStreamWriteInt( pFile, strlen(p->pName)+1 );
+        Gia_AigerStreamWrite( pFile, p->pName, strlen(p->pName) );
+        Gia_AigerStreamPrintf( pFile, "%c", '\0' );
     }
     // write comments
     if ( fWriteNewLine )
-        fprintf( pFile, "c\n" );
-    fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
-    fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
-    fclose( pFile );
+        Gia_AigerStreamPrintf( pFile, "c\n" );
+    Gia_AigerStreamPrintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
+    Gia_AigerStreamPrintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
     if ( p != pInit )
     {
         Gia_ManTransferTiming( pInit, p );
         Gia_ManStop( p );
     }
 }
+void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine )
+{
+    Gia_AigerStream_t * pFile;
+    if ( Gia_ManCoNum(pInit) == 0 )
+    {
+        printf( "AIG cannot be written because it has no POs.\n" );
+        return;
+    }
+    // start the output stream
+    pFile = Gia_AigerStreamOpen( pFileName, Gia_AigerReadProcs() );
+    if ( pFile == NULL )
+    {
+        fprintf( stdout, "Gia_AigerWrite(): Cannot open the output file \"%s\".\n", pFileName );
+        return;
+    }
+    Gia_AigerWriteStream( pInit, pFile, fWriteSymbols, fCompact, fWriteNewLine );
+    if ( !Gia_AigerStreamClose( pFile ) )
+        fprintf( stdout, "Gia_AigerWrite(): Writing the output file \"%s\" has failed.\n", pFileName );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the AIG with all extensions into the memory buffer.]
+
+  Description [Unlike Gia_AigerWriteIntoMemoryStr(), which only saves the
+  structure, the result can be read back by Gia_AigerReadFromMemory()
+  together with the mapping, the names, and other annotations.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Str_t * Gia_AigerWriteIntoMemoryStrAll( Gia_Man_t * p )
+{
+    Vec_Str_t * vOut = Vec_StrAlloc( 1000 );
+    Gia_AigerStream_t * pFile = Gia_AigerStreamOpenStr( vOut );
+    Gia_AigerWriteStream( p, pFile, 1, 0, 0 );
+    Gia_AigerStreamClose( pFile );
+    return vOut;
+}
 
 /**Function*************************************************************
 
@@ -0,0 +1,488 @@
+/**CFile****************************************************************
+
+  FileName    [giaAigerStream.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Streaming output with background gzip compression.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaAigerStream.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdarg.h>
+#include "gia.h"
+#include "misc/zlib/zlib.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define GIA_STREAM_BLOCK    (1 << 20)  // the size of one uncompressed block
+#define GIA_STREAM_THR_MAX  64         // the max number of compression threads
+
+// one block of the output compressed as a separate gzip member
+typedef struct Gia_StreamJob_t_ Gia_StreamJob_t;
+struct Gia_StreamJob_t_
+{
+    char *           pIn;          // uncompressed data
+    int              nIn;          // the size of uncompressed data
+    char *           pOut;         // compressed data
+    int              nOut;         // the size of compressed data
+    int              nOutAlloc;    // the allocated size of compressed data
+    int              fError;       // set to 1 if compression failed
+    volatile int     Status;       // 0 = free, 1 = submitted, 2 = compressing, 3 = compressed
+};
+
+struct Gia_AigerStream_t_
+{
+    FILE *           pFile;        // the output file
+    Vec_Str_t *      vOut;         // the output buffer (when writing into memory)
+    int              fCompress;    // compress the output using gzip
+    int              fError;       // set to 1 if writing failed
+    int              nProcs;       // the number of compression threads
+    char *           pBlock;       // the block being filled
+    int              nBlock;       // the size of data in this block
+    Gia_StreamJob_t* pJobs;        // compression jobs (circular buffer)
+    int              nJobs;        // the number of jobs
+    int              iSubmit;      // the number of submitted jobs
+    int              iWrite;       // the number of written jobs
+#ifdef ABC_USE_PTHREADS
+    volatile int     fStop;        // signals the threads to quit
+    pthread_t        pThreads[GIA_STREAM_THR_MAX];
+    pthread_mutex_t  Mutex;        // protects the status of the jobs
+    pthread_cond_t   CondSubmit;   // signaled when a job is submitted
+    pthread_cond_t   CondDone;     // signaled when a job is compressed
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Compresses one block into a gzip member.]
+
+  Description [The concatenation of gzip members is a valid gzip file,
+  so the blocks can be compressed independently and in parallel.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_StreamJobCompress( Gia_StreamJob_t * pJob )
+{
+    z_stream Strm;
+    int nBound, status;
+    memset( &Strm, 0, sizeof(z_stream) );
+    pJob->nOut = 0;
+    pJob->fError = 1;
+    if ( deflateInit2( &Strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY ) != Z_OK )
+        return;
+    nBound = (int)deflateBound( &Strm, (uLong)pJob->nIn ) + 32;
+    if ( pJob->nOutAlloc < nBound )
+    {
+        pJob->pOut = ABC_REALLOC( char, pJob->pOut, nBound );
+        pJob->nOutAlloc = nBound;
+    }
+    Strm.next_in   = (Bytef *)pJob->pIn;
+    Strm.avail_in  = (uInt)pJob->nIn;
+    Strm.next_out  = (Bytef *)pJob->pOut;
+    Strm.avail_out = (uInt)pJob->nOutAlloc;
+    status = deflate( &Strm, Z_FINISH );
+    pJob->nOut = pJob->nOutAlloc - (int)Strm.avail_out;
+    deflateEnd( &Strm );
+    pJob->fError = (status != Z_STREAM_END);
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Compression thread.]
+
+  Description [Takes the submitted jobs in any order and compresses them.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_StreamWorkerThread( void * pArg )
+{
+    Gia_AigerStream_t * p = (Gia_AigerStream_t *)pArg;
+    Gia_StreamJob_t * pJob;
+    int i, status;
+    status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+    while ( 1 )
+    {
+        pJob = NULL;
+        for ( i = 0; i < p->nJobs; i++ )
+            if ( p->pJobs[i].Status == 1 )
+            {
+                pJob = p->pJobs + i;
+                break;
+            }
+        if ( pJob == NULL )
+        {
+            if ( p->fStop )
+                break;
+            status = pthread_cond_wait( &p->CondSubmit, &p->Mutex );  assert( status == 0 );
+            continue;
+        }
+        pJob->Status = 2;
+        status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+        Gia_StreamJobCompress( pJob );
+        status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+        pJob->Status = 3;
+        status = pthread_cond_broadcast( &p->CondDone );  assert( status == 0 );
+    }
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    pthread_exit( NULL );
+    assert(0);
+    return NULL;
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the oldest submitted job into the file.]
+
+  Description [Waits until the job is compressed. Because the jobs are
+  written in the order of submission, the output does not depend on the
+  number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_StreamWriteNext( Gia_AigerStream_t * p )
+{
+    Gia_StreamJob_t * pJob = p->pJobs + p->iWrite % p->nJobs;
+    assert( p->iWrite < p->iSubmit );
+#ifdef ABC_USE_PTHREADS
+    {
+        int status;
+        status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+        while ( pJob->Status != 3 )
+        {
+            status = pthread_cond_wait( &p->CondDone, &p->Mutex );  assert( status == 0 );
+        }
+        status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    }
+#endif
+    assert( pJob->Status == 3 );
+    if ( pJob->fError || fwrite( pJob->pOut, 1, (size_t)pJob->nOut, p->pFile ) != (size_t)pJob->nOut )
+        p->fError = 1;
+    pJob->Status = 0;
+    p->iWrite++;
+}
+int Gia_StreamJobIsDone( Gia_AigerStream_t * p, Gia_StreamJob_t * pJob )
+{
+    int Status;
+#ifdef ABC_USE_PTHREADS
+    int status;
+    status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+    Status = pJob->Status;
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+#else
+    Status = pJob->Status;
+#endif
+    return Status == 3;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Hands the current block over to the compression threads.]
+
+  Description [If all jobs are in progress, writes the oldest one first,
+  which bounds the memory used by the stream. Also writes the jobs that
+  are already compressed, so that the file grows while the caller works.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_StreamSubmit( Gia_AigerStream_t * p )
+{
+    Gia_StreamJob_t * pJob = p->pJobs + p->iSubmit % p->nJobs;
+    char * pTemp;
+    if ( p->nBlock == 0 )
+        return;
+    if ( p->iSubmit - p->iWrite == p->nJobs )
+        Gia_StreamWriteNext( p );
+    assert( pJob->Status == 0 );
+    // swap the buffers instead of copying the data
+    if ( pJob->pIn == NULL )
+        pJob->pIn = ABC_ALLOC( char, GIA_STREAM_BLOCK );
+    pTemp = pJob->pIn; pJob->pIn = p->pBlock; p->pBlock = pTemp;
+    pJob->nIn = p->nBlock;
+    p->nBlock = 0;
+    p->iSubmit++;
+#ifdef ABC_USE_PTHREADS
+    {
+        int status;
+        status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+        pJob->Status = 1;
+        status = pthread_cond_signal( &p->CondSubmit );  assert( status == 0 );
+        status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    }
+#else
+    Gia_StreamJobCompress( pJob );
+    pJob->Status = 3;
+#endif
+    while ( p->iWrite < p->iSubmit && Gia_StreamJobIsDone(p, p->pJobs + p->iWrite % p->nJobs) )
+        Gia_StreamWriteNext( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Opens the output stream.]
+
+  Description [If the file name ends with ".gz", the output is compressed
+  by nProcs background threads, one block at a time; otherwise, the output
+  is written directly into the file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_AigerStream_t * Gia_AigerStreamOpen( char * pFileName, int nProcs )
+{
+    Gia_AigerStream_t * p;
+    FILE * pFile = fopen( pFileName, "wb" );
+    int i, status;
+    if ( pFile == NULL )
+        return NULL;
+    p = ABC_CALLOC( Gia_AigerStream_t, 1 );
+    p->pFile     = pFile;
+    p->fCompress = strlen(pFileName) > 3 && !strcmp( pFileName + strlen(pFileName) - 3, ".gz" );
+    if ( !p->fCompress )
+        return p;
+    p->nProcs = Abc_MaxInt( 1, Abc_MinInt(nProcs, GIA_STREAM_THR_MAX) );
+    p->nJobs  = 2 * p->nProcs;
+    p->pJobs  = ABC_CALLOC( Gia_StreamJob_t, p->nJobs );
+    p->pBlock = ABC_ALLOC( char, GIA_STREAM_BLOCK );
+#ifdef ABC_USE_PTHREADS
+    status = pthread_mutex_init( &p->Mutex, NULL );       assert( status == 0 );
+    status = pthread_cond_init( &p->CondSubmit, NULL );   assert( status == 0 );
+    status = pthread_cond_init( &p->CondDone, NULL );     assert( status == 0 );
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        status = pthread_create( p->pThreads + i, NULL, Gia_StreamWorkerThread, (void *)p );
+        assert( status == 0 );
+    }
+#else
+    i = status = 0;
+#endif
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Opens the stream writing into memory.]
+
+  Description [The data is appended to vOut without compression.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_AigerStream_t * Gia_AigerStreamOpenStr( Vec_Str_t * vOut )
+{
+    Gia_AigerStream_t * p = ABC_CALLOC( Gia_AigerStream_t, 1 );
+    p->vOut = vOut;
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes data into the stream.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerStreamWrite( Gia_AigerStream_t * p, char * pData, int nSize )
+{
+    int nCopy;
+    if ( p->vOut )
+    {
+        if ( nSize > 0 )
+            Vec_StrPushBuffer( p->vOut, pData, nSize );
+        return;
+    }
+    if ( !p->fCompress )
+    {
+        if ( nSize > 0 && fwrite( pData, 1, (size_t)nSize, p->pFile ) != (size_t)nSize )
+            p->fError = 1;
+        return;
+    }
+    while ( nSize > 0 )
+    {
+        nCopy = Abc_MinInt( nSize, GIA_STREAM_BLOCK - p->nBlock );
+        memcpy( p->pBlock + p->nBlock, pData, (size_t)nCopy );
+        p->nBlock += nCopy;
+        pData += nCopy;
+        nSize -= nCopy;
+        if ( p->nBlock == GIA_STREAM_BLOCK )
+            Gia_StreamSubmit( p );
+    }
+}
+void Gia_AigerStreamWriteInt( Gia_AigerStream_t * p, int Value )
+{
+    unsigned char Buffer[5];
+    Gia_AigerWriteInt( Buffer, Value );
+    Gia_AigerStreamWrite( p, (char *)Buffer, 4 );
+}
+void Gia_AigerStreamPrintf( Gia_AigerStream_t * p, const char * pFormat, ... )
+{
+    char Buffer[1000], * pBuffer = Buffer;
+    va_list args;
+    int nSize;
+    va_start( args, pFormat );
+    nSize = vsnprintf( Buffer, sizeof(Buffer), pFormat, args );
+    va_end( args );
+    if ( nSize < 0 )
+    {
+        p->fError = 1;
+        return;
+    }
+    if ( nSize >= (int)sizeof(Buffer) )
+    {
+        pBuffer = ABC_ALLOC( char, nSize + 1 );
+        va_start( args, pFormat );
+        vsnprintf( pBuffer, (size_t)nSize + 1, pFormat, args );
+        va_end( args );
+    }
+    Gia_AigerStreamWrite( p, pBuffer, nSize );
+    if ( pBuffer != Buffer )
+        ABC_FREE( pBuffer );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Flushes and closes the stream.]
+
+  Description [Returns 1 if all data was successfully written.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_AigerStreamClose( Gia_AigerStream_t * p )
+{
+    int i, RetValue;
+    if ( p->fCompress )
+    {
+        Gia_StreamSubmit( p );
+        while ( p->iWrite < p->iSubmit )
+            Gia_StreamWriteNext( p );
+#ifdef ABC_USE_PTHREADS
+        {
+            int status;
+            status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+            p->fStop = 1;
+            status = pthread_cond_broadcast( &p->CondSubmit );  assert( status == 0 );
+            status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+            for ( i = 0; i < p->nProcs; i++ )
+            {
+                status = pthread_join( p->pThreads[i], NULL );
+                assert( status == 0 );
+            }
+            pthread_cond_destroy( &p->CondDone );
+            pthread_cond_destroy( &p->CondSubmit );
+            pthread_mutex_destroy( &p->Mutex );
+        }
+#endif
+        for ( i = 0; i < p->nJobs; i++ )
+        {
+            ABC_FREE( p->pJobs[i].pIn );
+            ABC_FREE( p->pJobs[i].pOut );
+        }
+        ABC_FREE( p->pJobs );
+        ABC_FREE( p->pBlock );
+    }
+    if ( p->pFile && fclose( p->pFile ) != 0 )
+        p->fError = 1;
+    RetValue = !p->fError;
+    ABC_FREE( p );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the gzip-compressed file into a buffer.]
+
+  Description [The buffer is doubled whenever it is full. Returns NULL if
+  the file cannot be opened.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_AigerStreamReadGz( char * pFileName, int * pnFileSize )
+{
+    gzFile pFile;
+    char * pContents;
+    int nRead, nFileSize = 0, nAlloc = GIA_STREAM_BLOCK;
+    pFile = gzopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    pContents = ABC_ALLOC( char, nAlloc );
+    while ( (nRead = gzread( pFile, pContents + nFileSize, nAlloc - nFileSize )) > 0 )
+    {
+        nFileSize += nRead;
+        if ( nFileSize == nAlloc )
+            pContents = ABC_REALLOC( char, pContents, (nAlloc *= 2) );
+    }
+    gzclose( pFile );
+    if ( nRead < 0 )
+    {
+        ABC_FREE( pContents );
+        return NULL;
+    }
+    *pnFileSize = nFileSize;
+    return pContents;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -769,11 +769,57 @@ Gia_Man_t * Gia_ManDup2( Gia_Man_t * p1, Gia_Man_t * p2 )
     Gia_ManHashStop( pNew );
     return pNew;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Duplicates AIG together with mapping and other attributes.]
+
+  Description [Used to take snapshots of the current AIG (&save, &load, etc).
+  Since the copy is exact, the object array, the CI/CO lists and the object-
+  indexed attributes are copied wholesale instead of being rebuilt node by
+  node, which makes the snapshot cost a few memory copies.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 Gia_Man_t * Gia_ManDupWithAttributes( Gia_Man_t * p )
 {
-    Gia_Man_t * pNew = Gia_ManDup(p);
-    Gia_ManTransferMapping( pNew, p );
-    Gia_ManTransferPacking( pNew, p );
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    int i;
+    pNew = ABC_CALLOC( Gia_Man_t, 1 );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    pNew->nObjs = pNew->nObjsAlloc = p->nObjs;
+    pNew->pObjs = ABC_ALLOC( Gia_Obj_t, p->nObjs );
+    memcpy( pNew->pObjs, p->pObjs, sizeof(Gia_Obj_t) * p->nObjs );
+    Gia_ManForEachObj( pNew, pObj, i )
+        pObj->fMark0 = pObj->fMark1 = pObj->fPhase = 0, pObj->Value = 0;
+    if ( p->pMuxes )
+    {
+        pNew->pMuxes = ABC_ALLOC( unsigned, p->nObjs );
+        memcpy( pNew->pMuxes, p->pMuxes, sizeof(unsigned) * p->nObjs );
+    }
+    if ( p->pSibls )
+    {
+        pNew->pSibls = ABC_ALLOC( int, p->nObjs );
+        memcpy( pNew->pSibls, p->pSibls, sizeof(int) * p->nObjs );
+    }
+    pNew->vCis   = Vec_IntDup( p->vCis );
+    pNew->vCos   = Vec_IntDup( p->vCos );
+    pNew->nRegs  = p->nRegs;
+    pNew->nXors  = p->nXors;
+    pNew->nMuxes = p->nMuxes;
+    pNew->nBufs  = p->nBufs;
+    if ( p->pCexSeq )
+        pNew->pCexSeq = Abc_CexDup( p->pCexSeq, Gia_ManRegNum(p) );
+    // object IDs are unchanged, so the mapping is copied as is
+    if ( p->vMapping )
+        pNew->vMapping = Vec_IntDup( p->vMapping );
+    if ( p->vPacking )
+        pNew->vPacking = Vec_IntDup( p->vPacking );
     if ( p->pManTime )
         pNew->pManTime = Tim_ManDup( (Tim_Man_t *)p->pManTime, 0 );
     if ( p->pAigExtra )
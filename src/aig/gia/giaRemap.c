@@ -0,0 +1,654 @@
+/**CFile****************************************************************
+
+  FileName    [giaRemap.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Incremental LUT remapping of modified regions.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaRemap.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define RMP_LEAF_MAX   8     // the largest LUT size
+#define RMP_CUT_MAX    8     // the largest number of cuts per node
+#define RMP_INFINITY   ABC_INFINITY
+
+typedef struct Rmp_Cut_t_ Rmp_Cut_t;
+struct Rmp_Cut_t_
+{
+    word             Sign;       // signature of the leaves
+    float            Flow;       // area flow
+    int              Delay;      // arrival time
+    int              nLeaves;    // the number of leaves
+    int              pLeaves[RMP_LEAF_MAX];
+};
+
+typedef struct Rmp_Man_t_ Rmp_Man_t;
+struct Rmp_Man_t_
+{
+    Gia_Man_t *      p;          // mapped AIG
+    int              nLutSize;   // LUT size
+    int              nCutNum;    // cuts per node
+    int              DelayTarget;// the mapping depth to be preserved
+    Vec_Int_t *      vRegion;    // region nodes in a topological order
+    Vec_Int_t *      vPos;       // mapping of objects into region positions
+    Vec_Int_t *      vCutNums;   // the number of cuts of each region node
+    Rmp_Cut_t *      pCuts;      // cuts of region nodes
+    int *            pArrival;   // arrival times of objects
+    int *            pRequired;  // required times of region nodes
+    float *          pFlow;      // area flow of region nodes
+    int *            pRefs;      // fanout counters
+    Vec_Int_t *      vRoots;     // selected roots in the region
+    // statistics
+    int              nLutsOld;   // removed LUTs
+    int              nLutsNew;   // added LUTs
+};
+
+static inline int         Rmp_ObjPos( Rmp_Man_t * p, int iObj )               { return Vec_IntEntry(p->vPos, iObj);                              }
+static inline int         Rmp_ObjInRegion( Rmp_Man_t * p, int iObj )          { return Rmp_ObjPos(p, iObj) >= 0;                                  }
+static inline Rmp_Cut_t * Rmp_ObjCuts( Rmp_Man_t * p, int iObj )              { return p->pCuts + Rmp_ObjPos(p, iObj) * p->nCutNum;              }
+static inline int         Rmp_ObjCutNum( Rmp_Man_t * p, int iObj )            { return Vec_IntEntry(p->vCutNums, Rmp_ObjPos(p, iObj));            }
+static inline float       Rmp_ObjFlow( Rmp_Man_t * p, int iObj )              { return Rmp_ObjInRegion(p, iObj) ? p->pFlow[iObj] : (float)0.0;   }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Collects nodes whose mapping is missing.]
+
+  Description [Returns AND nodes that are used as LUT fanins or CO
+  drivers but do not have a LUT of their own. These are the nodes
+  left without mapping after a local edit of the AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_ManMappingCollectBroken( Gia_Man_t * p )
+{
+    Vec_Int_t * vBroken = Vec_IntAlloc( 100 );
+    Gia_Obj_t * pObj;
+    int i, k, iFan;
+    assert( Gia_ManHasMapping(p) );
+    Gia_ManIncrementTravId( p );
+    Gia_ManForEachLut( p, i )
+        Gia_LutForEachFanin( p, i, iFan, k )
+            if ( Gia_ObjIsAnd(Gia_ManObj(p, iFan)) && !Gia_ObjIsLut(p, iFan) && !Gia_ObjIsTravIdCurrentId(p, iFan) )
+            {
+                Gia_ObjSetTravIdCurrentId( p, iFan );
+                Vec_IntPush( vBroken, iFan );
+            }
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        iFan = Gia_ObjFaninId0p( p, pObj );
+        if ( Gia_ObjIsAnd(Gia_ManObj(p, iFan)) && !Gia_ObjIsLut(p, iFan) && !Gia_ObjIsTravIdCurrentId(p, iFan) )
+        {
+            Gia_ObjSetTravIdCurrentId( p, iFan );
+            Vec_IntPush( vBroken, iFan );
+        }
+    }
+    Vec_IntSort( vBroken, 0 );
+    return vBroken;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the region to be remapped.]
+
+  Description [The region includes the TFO of the changed nodes and the
+  part of their TFI that is not covered by the fixed LUTs. The LUTs
+  rooted outside of the region are unaffected by the change.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Rmp_ManExtend_rec( Rmp_Man_t * p, int iObj, Vec_Bit_t * vMarks )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->p, iObj );
+    if ( Vec_BitEntry(vMarks, iObj) || !Gia_ObjIsAnd(pObj) || Gia_ObjIsLut(p->p, iObj) )
+        return;
+    Vec_BitWriteEntry( vMarks, iObj, 1 );
+    Rmp_ManExtend_rec( p, Gia_ObjFaninId0(pObj, iObj), vMarks );
+    Rmp_ManExtend_rec( p, Gia_ObjFaninId1(pObj, iObj), vMarks );
+}
+void Rmp_ManCollectRegion( Rmp_Man_t * p, Vec_Int_t * vChanged )
+{
+    Gia_Man_t * pGia = p->p;
+    Vec_Bit_t * vMarks = Vec_BitStart( Gia_ManObjNum(pGia) );
+    Vec_Int_t * vTfo = Vec_IntAlloc( 100 );
+    Gia_Obj_t * pObj;
+    int i, iObj, iFirst = Gia_ManObjNum(pGia);
+    // mark the TFO of the changed nodes
+    Vec_IntForEachEntry( vChanged, iObj, i )
+    {
+        if ( !Gia_ObjIsAnd(Gia_ManObj(pGia, iObj)) )
+            continue;
+        Vec_BitWriteEntry( vMarks, iObj, 1 );
+        iFirst = Abc_MinInt( iFirst, iObj );
+    }
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        if ( i < iFirst )
+            continue;
+        if ( Vec_BitEntry(vMarks, i) || Vec_BitEntry(vMarks, Gia_ObjFaninId0(pObj, i)) || Vec_BitEntry(vMarks, Gia_ObjFaninId1(pObj, i)) )
+        {
+            Vec_BitWriteEntry( vMarks, i, 1 );
+            Vec_IntPush( vTfo, i );
+        }
+    }
+    // add the TFI nodes that are not roots of the fixed LUTs
+    Vec_IntForEachEntry( vTfo, iObj, i )
+    {
+        pObj = Gia_ManObj( pGia, iObj );
+        Rmp_ManExtend_rec( p, Gia_ObjFaninId0(pObj, iObj), vMarks );
+        Rmp_ManExtend_rec( p, Gia_ObjFaninId1(pObj, iObj), vMarks );
+    }
+    // collect the region in a topological order
+    Gia_ManForEachAnd( pGia, pObj, i )
+        if ( Vec_BitEntry(vMarks, i) )
+        {
+            Vec_IntWriteEntry( p->vPos, i, Vec_IntSize(p->vRegion) );
+            Vec_IntPush( p->vRegion, i );
+        }
+    Vec_IntFree( vTfo );
+    Vec_BitFree( vMarks );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Manager procedures.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Rmp_Man_t * Rmp_ManStart( Gia_Man_t * pGia, int nLutSize, int nCutNum )
+{
+    Rmp_Man_t * p = ABC_CALLOC( Rmp_Man_t, 1 );
+    p->p         = pGia;
+    p->nLutSize  = nLutSize;
+    p->nCutNum   = nCutNum;
+    p->vRegion   = Vec_IntAlloc( 1000 );
+    p->vPos      = Vec_IntStartFull( Gia_ManObjNum(pGia) );
+    p->vRoots    = Vec_IntAlloc( 1000 );
+    p->pArrival  = ABC_CALLOC( int, Gia_ManObjNum(pGia) );
+    p->pRequired = ABC_CALLOC( int, Gia_ManObjNum(pGia) );
+    p->pFlow     = ABC_CALLOC( float, Gia_ManObjNum(pGia) );
+    p->pRefs     = ABC_CALLOC( int, Gia_ManObjNum(pGia) );
+    return p;
+}
+void Rmp_ManStop( Rmp_Man_t * p )
+{
+    Vec_IntFree( p->vRegion );
+    Vec_IntFree( p->vPos );
+    Vec_IntFree( p->vRoots );
+    Vec_IntFreeP( &p->vCutNums );
+    ABC_FREE( p->pCuts );
+    ABC_FREE( p->pArrival );
+    ABC_FREE( p->pRequired );
+    ABC_FREE( p->pFlow );
+    ABC_FREE( p->pRefs );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes arrival times of the fixed LUTs.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Rmp_ManComputeFixed( Rmp_Man_t * p )
+{
+    Gia_Man_t * pGia = p->p;
+    Gia_Obj_t * pObj;
+    int i, k, iFan, Level;
+    Gia_ManForEachLut( pGia, i )
+    {
+        if ( Rmp_ObjInRegion(p, i) )
+            continue;
+        Level = 0;
+        Gia_LutForEachFanin( pGia, i, iFan, k )
+            Level = Abc_MaxInt( Level, p->pArrival[iFan] );
+        p->pArrival[i] = Level + 1;
+    }
+    // fanout counters of the current mapping are used to estimate area flow
+    Gia_ManForEachLut( pGia, i )
+        Gia_LutForEachFanin( pGia, i, iFan, k )
+            p->pRefs[iFan]++;
+    Gia_ManForEachCo( pGia, pObj, i )
+        p->pRefs[Gia_ObjFaninId0p(pGia, pObj)]++;
+    // the nodes that are not LUT roots use their structural fanout counters
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        if ( Rmp_ObjInRegion(p, Gia_ObjFaninId0(pObj, i)) && !Gia_ObjIsLut(pGia, Gia_ObjFaninId0(pObj, i)) )
+            p->pRefs[Gia_ObjFaninId0(pObj, i)]++;
+        if ( Rmp_ObjInRegion(p, Gia_ObjFaninId1(pObj, i)) && !Gia_ObjIsLut(pGia, Gia_ObjFaninId1(pObj, i)) )
+            p->pRefs[Gia_ObjFaninId1(pObj, i)]++;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cut manipulation.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Rmp_CutMerge( Rmp_Cut_t * pCut0, Rmp_Cut_t * pCut1, Rmp_Cut_t * pCut, int nLutSize )
+{
+    int i = 0, k = 0, c = 0;
+    if ( pCut0->nLeaves + pCut1->nLeaves > nLutSize && Abc_TtCountOnes(pCut0->Sign | pCut1->Sign) > nLutSize )
+        return 0;
+    while ( i < pCut0->nLeaves || k < pCut1->nLeaves )
+    {
+        if ( c == nLutSize )
+            return 0;
+        if ( k == pCut1->nLeaves || (i < pCut0->nLeaves && pCut0->pLeaves[i] < pCut1->pLeaves[k]) )
+            pCut->pLeaves[c++] = pCut0->pLeaves[i++];
+        else if ( i == pCut0->nLeaves || pCut0->pLeaves[i] > pCut1->pLeaves[k] )
+            pCut->pLeaves[c++] = pCut1->pLeaves[k++];
+        else
+            pCut->pLeaves[c++] = pCut0->pLeaves[i++], k++;
+    }
+    pCut->nLeaves = c;
+    pCut->Sign    = pCut0->Sign | pCut1->Sign;
+    return 1;
+}
+static inline int Rmp_CutDominates( Rmp_Cut_t * pDom, Rmp_Cut_t * pCut )
+{
+    int i, k;
+    if ( pDom->nLeaves > pCut->nLeaves || (pDom->Sign & pCut->Sign) != pDom->Sign )
+        return 0;
+    for ( i = k = 0; i < pDom->nLeaves; i++ )
+    {
+        while ( k < pCut->nLeaves && pCut->pLeaves[k] < pDom->pLeaves[i] )
+            k++;
+        if ( k == pCut->nLeaves || pCut->pLeaves[k] != pDom->pLeaves[i] )
+            return 0;
+    }
+    return 1;
+}
+static inline int Rmp_CutIsBetter( Rmp_Cut_t * pCut0, Rmp_Cut_t * pCut1, int Required, int fArea )
+{
+    if ( fArea )
+    {
+        if ( (pCut0->Delay <= Required) != (pCut1->Delay <= Required) )
+            return pCut0->Delay <= Required;
+        if ( pCut0->Flow < pCut1->Flow - 0.001 )
+            return 1;
+        if ( pCut0->Flow > pCut1->Flow + 0.001 )
+            return 0;
+        if ( pCut0->Delay != pCut1->Delay )
+            return pCut0->Delay < pCut1->Delay;
+        return pCut0->nLeaves < pCut1->nLeaves;
+    }
+    if ( pCut0->Delay != pCut1->Delay )
+        return pCut0->Delay < pCut1->Delay;
+    if ( pCut0->Flow < pCut1->Flow - 0.001 )
+        return 1;
+    if ( pCut0->Flow > pCut1->Flow + 0.001 )
+        return 0;
+    return pCut0->nLeaves < pCut1->nLeaves;
+}
+static inline void Rmp_CutSetTrivial( Rmp_Cut_t * pCut, int iObj )
+{
+    pCut->nLeaves    = 1;
+    pCut->pLeaves[0] = iObj;
+    pCut->Sign       = ((word)1) << (iObj & 63);
+}
+static inline void Rmp_CutEvaluate( Rmp_Man_t * p, Rmp_Cut_t * pCut, int iObj )
+{
+    int i;
+    pCut->Delay = 0;
+    pCut->Flow  = 1.0;
+    for ( i = 0; i < pCut->nLeaves; i++ )
+    {
+        pCut->Delay = Abc_MaxInt( pCut->Delay, p->pArrival[pCut->pLeaves[i]] );
+        pCut->Flow += Rmp_ObjFlow( p, pCut->pLeaves[i] );
+    }
+    pCut->Delay += 1;
+    pCut->Flow  /= Abc_MaxInt( 1, p->pRefs[iObj] );
+}
+// adds the cut to the sorted set while filtering dominated cuts
+static inline int Rmp_CutSetAdd( Rmp_Cut_t * pSet, int nCuts, int nCutMax, Rmp_Cut_t * pCut, int Required, int fArea )
+{
+    int i, k;
+    for ( i = 0; i < nCuts; i++ )
+        if ( Rmp_CutDominates(pSet + i, pCut) )
+            return nCuts;
+    for ( i = k = 0; i < nCuts; i++ )
+        if ( !Rmp_CutDominates(pCut, pSet + i) )
+            pSet[k++] = pSet[i];
+    nCuts = k;
+    for ( i = nCuts; i > 0 && Rmp_CutIsBetter(pCut, pSet + i - 1, Required, fArea); i-- )
+        if ( i < nCutMax )
+            pSet[i] = pSet[i-1];
+    if ( i == nCutMax )
+        return nCuts;
+    pSet[i] = *pCut;
+    return Abc_MinInt( nCuts + 1, nCutMax );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Enumerates cuts of the region nodes.]
+
+  Description [The fanins outside of the region only have trivial cuts.
+  The nodes inside the region contribute their priority cuts and the
+  trivial cut, which makes them new LUT roots if selected. The first
+  pass sorts cuts by delay. The area recovery pass sorts them by area
+  flow, while keeping the cut selected by the previous pass to make sure
+  that the required times can be met.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Rmp_ManFaninCuts( Rmp_Man_t * p, int iFan, Rmp_Cut_t * pSet )
+{
+    int nCuts = 0;
+    if ( Rmp_ObjInRegion(p, iFan) )
+    {
+        nCuts = Rmp_ObjCutNum( p, iFan );
+        memcpy( pSet, Rmp_ObjCuts(p, iFan), sizeof(Rmp_Cut_t) * nCuts );
+    }
+    Rmp_CutSetTrivial( pSet + nCuts, iFan );
+    return nCuts + 1;
+}
+void Rmp_ManComputeCuts( Rmp_Man_t * p, int fArea )
+{
+    Rmp_Cut_t pSet0[RMP_CUT_MAX+1], pSet1[RMP_CUT_MAX+1], Cut, * pSet;
+    Gia_Obj_t * pObj;
+    int i, k, c0, c1, nCuts0, nCuts1, nCuts, Required;
+    if ( p->pCuts == NULL )
+    {
+        p->pCuts    = ABC_CALLOC( Rmp_Cut_t, Vec_IntSize(p->vRegion) * p->nCutNum );
+        p->vCutNums = Vec_IntStart( Vec_IntSize(p->vRegion) );
+    }
+    Vec_IntForEachEntry( p->vRegion, i, k )
+    {
+        pObj     = Gia_ManObj( p->p, i );
+        pSet     = Rmp_ObjCuts( p, i );
+        Required = fArea ? p->pRequired[i] : RMP_INFINITY;
+        nCuts0   = Rmp_ManFaninCuts( p, Gia_ObjFaninId0(pObj, i), pSet0 );
+        nCuts1   = Rmp_ManFaninCuts( p, Gia_ObjFaninId1(pObj, i), pSet1 );
+        nCuts    = 0;
+        if ( Required != RMP_INFINITY )
+        {
+            Cut = pSet[0];
+            Rmp_CutEvaluate( p, &Cut, i );
+            nCuts = Rmp_CutSetAdd( pSet, nCuts, p->nCutNum, &Cut, Required, fArea );
+        }
+        for ( c0 = 0; c0 < nCuts0; c0++ )
+        for ( c1 = 0; c1 < nCuts1; c1++ )
+        {
+            if ( !Rmp_CutMerge(pSet0 + c0, pSet1 + c1, &Cut, p->nLutSize) )
+                continue;
+            Rmp_CutEvaluate( p, &Cut, i );
+            nCuts = Rmp_CutSetAdd( pSet, nCuts, p->nCutNum, &Cut, Required, fArea );
+        }
+        assert( nCuts > 0 );
+        assert( pSet[0].Delay <= Required );
+        Vec_IntWriteEntry( p->vCutNums, k, nCuts );
+        p->pArrival[i] = pSet[0].Delay;
+        p->pFlow[i]    = pSet[0].Flow;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the cover of the region.]
+
+  Description [Roots are visited in a reverse topological order. Each
+  root takes the cut with the smallest area flow among those meeting
+  its required time, which is derived from the mapping depth.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Rmp_ManSelectCover( Rmp_Man_t * p )
+{
+    Gia_Man_t * pGia = p->p;
+    Gia_Obj_t * pObj;
+    Rmp_Cut_t * pSet, * pBest;
+    int i, k, c, iObj;
+    if ( p->DelayTarget == 0 )
+        Gia_ManForEachCo( pGia, pObj, i )
+            p->DelayTarget = Abc_MaxInt( p->DelayTarget, p->pArrival[Gia_ObjFaninId0p(pGia, pObj)] );
+    Vec_IntForEachEntry( p->vRegion, iObj, i )
+        p->pRequired[iObj] = RMP_INFINITY;
+    Gia_ManForEachCo( pGia, pObj, i )
+        if ( Rmp_ObjInRegion(p, Gia_ObjFaninId0p(pGia, pObj)) )
+            p->pRequired[Gia_ObjFaninId0p(pGia, pObj)] = p->DelayTarget;
+    Vec_IntClear( p->vRoots );
+    Vec_IntForEachEntryReverse( p->vRegion, iObj, i )
+    {
+        if ( p->pRequired[iObj] == RMP_INFINITY )
+            continue;
+        pSet  = Rmp_ObjCuts( p, iObj );
+        pBest = pSet;
+        for ( c = 1; c < Rmp_ObjCutNum(p, iObj); c++ )
+            if ( pSet[c].Delay <= p->pRequired[iObj] && pSet[c].Flow < pBest->Flow - 0.001 )
+                pBest = pSet + c;
+        assert( pBest->Delay <= p->pRequired[iObj] );
+        if ( pBest != pSet )
+            ABC_SWAP( Rmp_Cut_t, *pBest, *pSet );
+        for ( k = 0; k < pSet->nLeaves; k++ )
+            if ( Rmp_ObjInRegion(p, pSet->pLeaves[k]) )
+                p->pRequired[pSet->pLeaves[k]] = Abc_MinInt( p->pRequired[pSet->pLeaves[k]], p->pRequired[iObj] - 1 );
+        Vec_IntPush( p->vRoots, iObj );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rebuilds the mapping with the new LUTs of the region.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Rmp_ManDeriveMapping( Rmp_Man_t * p )
+{
+    Gia_Man_t * pGia = p->p;
+    Vec_Int_t * vMapping = Vec_IntAlloc( Vec_IntSize(pGia->vMapping) + 2 * Vec_IntSize(p->vRoots) );
+    Vec_Bit_t * vRoots = Vec_BitStart( Gia_ManObjNum(pGia) );
+    Rmp_Cut_t * pCut;
+    int i, k, iFan;
+    Vec_IntForEachEntry( p->vRoots, i, k )
+        Vec_BitWriteEntry( vRoots, i, 1 );
+    Vec_IntFill( vMapping, Gia_ManObjNum(pGia), 0 );
+    for ( i = 1; i < Gia_ManObjNum(pGia); i++ )
+    {
+        if ( Rmp_ObjInRegion(p, i) )
+        {
+            p->nLutsOld += Gia_ObjIsLut(pGia, i);
+            if ( !Vec_BitEntry(vRoots, i) )
+                continue;
+            pCut = Rmp_ObjCuts( p, i );
+            Vec_IntWriteEntry( vMapping, i, Vec_IntSize(vMapping) );
+            Vec_IntPush( vMapping, pCut->nLeaves );
+            for ( k = 0; k < pCut->nLeaves; k++ )
+                Vec_IntPush( vMapping, pCut->pLeaves[k] );
+            Vec_IntPush( vMapping, i );
+            p->nLutsNew++;
+        }
+        else if ( Gia_ObjIsLut(pGia, i) )
+        {
+            Vec_IntWriteEntry( vMapping, i, Vec_IntSize(vMapping) );
+            Vec_IntPush( vMapping, Gia_ObjLutSize(pGia, i) );
+            Gia_LutForEachFanin( pGia, i, iFan, k )
+                Vec_IntPush( vMapping, iFan );
+            Vec_IntPush( vMapping, i );
+        }
+    }
+    Vec_BitFree( vRoots );
+    Vec_IntFree( pGia->vMapping );
+    pGia->vMapping = vMapping;
+    // the remaining mapping-related data is no longer valid
+    Vec_IntFreeP( &pGia->vPacking );
+    Vec_IntFreeP( &pGia->vEdge1 );
+    Vec_IntFreeP( &pGia->vEdge2 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Incrementally remaps the region affected by local changes.]
+
+  Description [Takes the AIG with the LUT mapping, which is valid
+  everywhere except for the TFO of the changed nodes. If vChanged is
+  NULL, the changed nodes are the nodes left without mapping. Cuts are
+  computed and covers are selected only in the affected region, while
+  the LUTs rooted outside of it are kept unchanged. Returns the number
+  of nodes in the remapped region or -1 if remapping is not possible.
+  The LUTs already removed by the caller (nLutsRemoved) are only used
+  to report the number of old LUTs in the region.]
+
+  SideEffects [Updates the mapping of the AIG.]
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ManMappingIncrementalInt( Gia_Man_t * pGia, Vec_Int_t * vChanged, int nLutSize, int nLutsRemoved, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    Vec_Int_t * vBroken = NULL;
+    Rmp_Man_t * p;
+    int nRegion;
+    if ( !Gia_ManHasMapping(pGia) )
+    {
+        printf( "Gia_ManMappingIncremental(): The AIG is not LUT-mapped.\n" );
+        return -1;
+    }
+    if ( Gia_ManBufNum(pGia) || pGia->pManTime )
+    {
+        printf( "Gia_ManMappingIncremental(): AIGs with buffers or boxes are not supported.\n" );
+        return -1;
+    }
+    if ( nLutSize == 0 )
+        nLutSize = Gia_ManLutSizeMax( pGia );
+    if ( nLutSize < 2 || nLutSize > RMP_LEAF_MAX )
+    {
+        printf( "Gia_ManMappingIncremental(): LUT size (%d) should be between 2 and %d.\n", nLutSize, RMP_LEAF_MAX );
+        return -1;
+    }
+    if ( vChanged == NULL )
+        vChanged = vBroken = Gia_ManMappingCollectBroken( pGia );
+    p = Rmp_ManStart( pGia, nLutSize, RMP_CUT_MAX );
+    p->nLutsOld = nLutsRemoved;
+    Rmp_ManCollectRegion( p, vChanged );
+    Rmp_ManComputeFixed( p );
+    Rmp_ManComputeCuts( p, 0 );
+    Rmp_ManSelectCover( p );
+    Rmp_ManComputeCuts( p, 1 );
+    Rmp_ManSelectCover( p );
+    Rmp_ManDeriveMapping( p );
+    if ( fVerbose )
+    {
+        printf( "Changed = %d.  Region = %d. (%.2f %%)  Region LUTs: old = %d  new = %d.  ",
+            Vec_IntSize(vChanged), Vec_IntSize(p->vRegion), 100.0 * Vec_IntSize(p->vRegion) / Abc_MaxInt(1, Gia_ManAndNum(pGia)), p->nLutsOld, p->nLutsNew );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    nRegion = Vec_IntSize(p->vRegion);
+    Rmp_ManStop( p );
+    Vec_IntFreeP( &vBroken );
+    return nRegion;
+}
+int Gia_ManMappingIncremental( Gia_Man_t * pGia, Vec_Int_t * vChanged, int nLutSize, int fVerbose )
+{
+    return Gia_ManMappingIncrementalInt( pGia, vChanged, nLutSize, 0, fVerbose );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Tests incremental remapping by removing random LUTs.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManMappingIncrementalTest( Gia_Man_t * pGia, int nRemove, int nLutSize, int fVerbose )
+{
+    Vec_Int_t * vLuts, * vChanged;
+    int i, iObj, nRegion;
+    if ( !Gia_ManHasMapping(pGia) )
+    {
+        printf( "Gia_ManMappingIncrementalTest(): The AIG is not LUT-mapped.\n" );
+        return -1;
+    }
+    // the LUT size is taken before the LUTs are removed
+    if ( nLutSize == 0 )
+        nLutSize = Gia_ManLutSizeMax( pGia );
+    vLuts = Vec_IntAlloc( Gia_ManAndNum(pGia) );
+    Gia_ManForEachLut( pGia, iObj )
+        Vec_IntPush( vLuts, iObj );
+    // select LUTs to be removed
+    Abc_Random( 1 );
+    vChanged = Vec_IntAlloc( nRemove );
+    for ( i = 0; i < nRemove && Vec_IntSize(vLuts) > 0; i++ )
+    {
+        int iPlace = Abc_Random(0) % Vec_IntSize(vLuts);
+        Vec_IntPush( vChanged, Vec_IntEntry(vLuts, iPlace) );
+        Vec_IntDrop( vLuts, iPlace );
+    }
+    Vec_IntForEachEntry( vChanged, iObj, i )
+        Vec_IntWriteEntry( pGia->vMapping, iObj, 0 );
+    Vec_IntSort( vChanged, 0 );
+    nRegion = Gia_ManMappingIncrementalInt( pGia, vChanged, nLutSize, Vec_IntSize(vChanged), fVerbose );
+    Vec_IntFree( vChanged );
+    Vec_IntFree( vLuts );
+    return nRegion;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
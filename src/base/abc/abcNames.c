@@ -72,6 +72,27 @@ char * Abc_ObjAssignName( Abc_Obj_t * pObj, char * pName, char * pSuffix )
     return Nm_ManStoreIdName( pObj->pNtk->pManName, pObj->Id, pObj->Type, pName, pSuffix );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Assigns the name of another object to the object.]
+
+  Description [Works as Abc_ObjAssignName( pObj, Abc_ObjName(pFrom), NULL ).
+  If the object pFrom has a stored name and the networks share their 
+  name storage (which is the case for networks derived from each other),
+  the name is transferred by reference without hashing the string.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Abc_ObjAssignNameFrom( Abc_Obj_t * pObj, Abc_Obj_t * pFrom )
+{
+    if ( Nm_ManFindNameById(pFrom->pNtk->pManName, pFrom->Id) == NULL )
+        return Abc_ObjAssignName( pObj, Abc_ObjName(pFrom), NULL );
+    return Nm_ManCopyIdName( pObj->pNtk->pManName, pObj->Id, pObj->Type, pFrom->pNtk->pManName, pFrom->Id );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Appends name to the prefix]
@@ -350,23 +350,23 @@ Abc_Obj_t * Abc_NtkDupObj( Abc_Ntk_t * pNtkNew, Abc_Obj_t * pObj, int fCopyName
         if ( Abc_ObjIsCi(pObj) )
         {
             if ( !Abc_NtkIsNetlist(pNtkNew) )
-                Abc_ObjAssignName( pObjNew, Abc_ObjName(Abc_ObjFanout0Ntk(pObj)), NULL );
+                Abc_ObjAssignNameFrom( pObjNew, Abc_ObjFanout0Ntk(pObj) );
         }
         else if ( Abc_ObjIsCo(pObj) )
         {
             if ( !Abc_NtkIsNetlist(pNtkNew) )
             {
                 if ( Abc_ObjIsPo(pObj) )
-                    Abc_ObjAssignName( pObjNew, Abc_ObjName(Abc_ObjFanin0Ntk(pObj)), NULL );
+                    Abc_ObjAssignNameFrom( pObjNew, Abc_ObjFanin0Ntk(pObj) );
                 else
                 {
                     assert( Abc_ObjIsLatch(Abc_ObjFanout0(pObj)) );
-                    Abc_ObjAssignName( pObjNew, Abc_ObjName(pObj), NULL );
+                    Abc_ObjAssignNameFrom( pObjNew, pObj );
                 }
             }
         }
         else if ( Abc_ObjIsBox(pObj) || Abc_ObjIsNet(pObj) )
-            Abc_ObjAssignName( pObjNew, Abc_ObjName(pObj), NULL );
+            Abc_ObjAssignNameFrom( pObjNew, pObj );
     }
     // copy functionality/names
     if ( Abc_ObjIsNode(pObj) ) // copy the function if functionality is compatible
@@ -28,12 +28,33 @@
 #include "bdd/extrab/extraBdd.h"
 #endif
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define ABC_CLP_THR_MAX    100   // the max number of threads
+#define ABC_CLP_BATCH        8   // the number of outputs per thread in one batch
+
+typedef struct Abc_ClpJob_t_ Abc_ClpJob_t;
+struct Abc_ClpJob_t_
+{
+    Gia_Man_t *       pGia;        // the cone of one output
+    Vec_Str_t *       vSop;        // the resulting SOP (NULL if not computed)
+};
+
 #ifdef ABC_USE_CUDD
 
 extern int Abc_NodeSupport( DdNode * bFunc, Vec_Str_t * vSupport, int nVars );
@@ -714,6 +735,131 @@ sat_solver * Abc_NtkClpDeriveSatSolver( Cnf_Dat_t * pCnf, int iCoObjId, Vec_Int_
     return pSat;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes SOPs of the output cones in parallel.]
+
+  Description [Output cones are extracted sequentially in batches, then 
+  the SAT-based ISOP computation runs concurrently, one cone per call.
+  The result is indexed by the position of the representative in the 
+  processing order. Entries are NULL for outputs with fewer than two 
+  support variables and for outputs whose SOP exceeded the cube limit 
+  or the conflict limit. Unless fFallback is set, the computation 
+  stops after the first batch containing a failed output.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkClpSolveJob( Abc_ClpJob_t * pJob, int nCubeLim, int nBTLimit, int fCanon, int fReverse )
+{
+    extern Vec_Str_t * Bmc_CollapseOneOld( Gia_Man_t * p, int nCubeLim, int nBTLimit, int fCanon, int fReverse, int fVerbose );
+    pJob->vSop = Bmc_CollapseOneOld( pJob->pGia, nCubeLim, nBTLimit, fCanon, fReverse, 0 );
+}
+
+#ifndef ABC_USE_PTHREADS
+
+void Abc_NtkClpSolveBatch( Abc_ClpJob_t * pJobs, int nJobs, int nCubeLim, int nBTLimit, int fCanon, int fReverse, int nProcs )
+{
+    int i;
+    for ( i = 0; i < nJobs; i++ )
+        if ( pJobs[i].pGia )
+            Abc_NtkClpSolveJob( pJobs + i, nCubeLim, nBTLimit, fCanon, fReverse );
+}
+
+#else // pthreads are used
+
+typedef struct Abc_ClpThData_t_
+{
+    Abc_ClpJob_t *    pJobs;       // the outputs of the batch
+    int               nJobs;       // the number of outputs in the batch
+    int *             pNext;       // the next output to solve
+    int               nCubeLim;    // the limit on the number of cubes
+    int               nBTLimit;    // the limit on the number of conflicts
+    int               fCanon;      // canonical ISOP computation
+    int               fReverse;    // reverse variable ordering
+} Abc_ClpThData_t;
+
+static pthread_mutex_t s_ClpParMutex = PTHREAD_MUTEX_INITIALIZER;
+
+void * Abc_NtkClpWorkerThread( void * pArg )
+{
+    Abc_ClpThData_t * pThData = (Abc_ClpThData_t *)pArg;
+    int i, status;
+    while ( 1 )
+    {
+        status = pthread_mutex_lock( &s_ClpParMutex );  assert( status == 0 );
+        i = (*pThData->pNext)++;
+        status = pthread_mutex_unlock( &s_ClpParMutex );  assert( status == 0 );
+        if ( i >= pThData->nJobs )
+            break;
+        if ( pThData->pJobs[i].pGia )
+            Abc_NtkClpSolveJob( pThData->pJobs + i, pThData->nCubeLim, pThData->nBTLimit, pThData->fCanon, pThData->fReverse );
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+void Abc_NtkClpSolveBatch( Abc_ClpJob_t * pJobs, int nJobs, int nCubeLim, int nBTLimit, int fCanon, int fReverse, int nProcs )
+{
+    pthread_t WorkerThread[ABC_CLP_THR_MAX];
+    Abc_ClpThData_t ThData[ABC_CLP_THR_MAX];
+    int i, status, iNext = 0;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pJobs    = pJobs;
+        ThData[i].nJobs    = nJobs;
+        ThData[i].pNext    = &iNext;
+        ThData[i].nCubeLim = nCubeLim;
+        ThData[i].nBTLimit = nBTLimit;
+        ThData[i].fCanon   = fCanon;
+        ThData[i].fReverse = fReverse;
+        status = pthread_create( WorkerThread + i, NULL, Abc_NtkClpWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+}
+
+#endif // pthreads are used
+
+Vec_Ptr_t * Abc_GiaDeriveSopsPar( Gia_Man_t * p, Vec_Wec_t * vSupps, Vec_Int_t * vReprs, int * pOrder, int nCubeLim, int nBTLimit, int fCanon, int fReverse, int fFallback, int nProcs )
+{
+    int nReprs = Vec_IntSize(vReprs);
+    int nBatch, k, iBeg, nJobs, fFailed = 0;
+    Vec_Ptr_t * vRes = Vec_PtrStart( nReprs );
+    Abc_ClpJob_t * pJobs;
+    nProcs = Abc_MinInt( nProcs, ABC_CLP_THR_MAX );
+    nBatch = nProcs * ABC_CLP_BATCH;
+    pJobs  = ABC_CALLOC( Abc_ClpJob_t, nBatch );
+    for ( iBeg = 0; iBeg < nReprs && !fFailed; iBeg += nBatch )
+    {
+        nJobs = Abc_MinInt( nBatch, nReprs - iBeg );
+        // extract the cones sequentially (this uses the traversal IDs of p)
+        for ( k = 0; k < nJobs; k++ )
+        {
+            int iCoThis = Vec_IntEntry( vReprs, pOrder[nReprs - 1 - (iBeg + k)] );
+            pJobs[k].vSop = NULL;
+            pJobs[k].pGia = NULL;
+            if ( Vec_IntSize(Vec_WecEntry(vSupps, iCoThis)) >= 2 )
+                pJobs[k].pGia = Gia_ManDupCones( p, &iCoThis, 1, 1 );
+        }
+        Abc_NtkClpSolveBatch( pJobs, nJobs, nCubeLim, nBTLimit, fCanon, fReverse, Abc_MinInt(nProcs, nJobs) );
+        for ( k = 0; k < nJobs; k++ )
+        {
+            if ( pJobs[k].pGia == NULL )
+                continue;
+            Gia_ManStopP( &pJobs[k].pGia );
+            Vec_PtrWriteEntry( vRes, iBeg + k, pJobs[k].vSop );
+            if ( pJobs[k].vSop == NULL && !fFallback )
+                fFailed = 1;
+        }
+    }
+    ABC_FREE( pJobs );
+    return vRes;
+}
 /**Function*************************************************************
 
   Synopsis    [Computes SOPs for each output.]
@@ -783,11 +929,11 @@ Vec_Str_t * Abc_NtkClpGiaOne2( Cnf_Dat_t * pCnf, Gia_Man_t * p, int iCo, int nCu
         Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
     return vSop; 
 }
-Vec_Ptr_t * Abc_GiaDeriveSops( Abc_Ntk_t * pNtkNew, Gia_Man_t * p, Vec_Wec_t * vSupps, int nCubeLim, int nBTLimit, int nCostMax, int fCanon, int fReverse, int fCnfShared, int fVerbose )
+Vec_Ptr_t * Abc_GiaDeriveSops( Abc_Ntk_t * pNtkNew, Gia_Man_t * p, Vec_Wec_t * vSupps, int nCubeLim, int nBTLimit, int nCostMax, int fCanon, int fReverse, int fCnfShared, int nProcs, int fFallback, int fVerbose )
 {
     ProgressBar * pProgress;
     abctime clk = Abc_Clock();
-    Vec_Ptr_t * vSops = NULL, * vSopsRepr;
+    Vec_Ptr_t * vSops = NULL, * vSopsRepr, * vSopsPar = NULL;
     Vec_Int_t * vReprs, * vClass, * vReprSuppSizes;
     int i, k, Entry, iCo, * pOrder;
     Vec_Wec_t * vClasses;
@@ -808,6 +954,10 @@ Vec_Ptr_t * Abc_GiaDeriveSops( Abc_Ntk_t * pNtkNew, Gia_Man_t * p, Vec_Wec_t * v
     pOrder = Abc_MergeSortCost( Vec_IntArray(vReprSuppSizes), Vec_IntSize(vReprSuppSizes) );
     Vec_IntFree( vReprSuppSizes );
     // consider SOPs for representatives
+    if ( fCnfShared && !fCanon )
+        nProcs = 1; // the shared CNF is not thread-safe
+    if ( nProcs > 1 )
+        vSopsPar = Abc_GiaDeriveSopsPar( p, vSupps, vReprs, pOrder, nCubeLim, nBTLimit, fCanon, fReverse, fFallback, nProcs );
     if ( fCnfShared )
     {
         vMap = Vec_IntStartFull( Gia_ManObjNum(p) );
@@ -827,10 +977,22 @@ Vec_Ptr_t * Abc_GiaDeriveSops( Abc_Ntk_t * pNtkNew, Gia_Man_t * p, Vec_Wec_t * v
             Vec_PtrWriteEntry( vSopsRepr, iEntry, (void *)(ABC_PTRINT_T)1 );
             continue;
         }
-        if ( fCnfShared && !fCanon )
+        if ( vSopsPar )
+        {
+            vSop = (Vec_Str_t *)Vec_PtrEntry( vSopsPar, i );
+            Vec_PtrWriteEntry( vSopsPar, i, NULL );
+            if ( vSop )
+                Abc_NtkCollapseReduce( vSop, vSupp, Vec_WecEntry(vClasses, iEntry), vSupps );
+        }
+        else if ( fCnfShared && !fCanon )
             vSop = Abc_NtkClpGiaOne2( pCnf, p, iCoThis, nCubeLim, nBTLimit, fCanon, fReverse, vSupp, vMap, i ? 0 : fVerbose, Vec_WecEntry(vClasses, iEntry), vSupps );
         else
             vSop = Abc_NtkClpGiaOne( p, iCoThis, nCubeLim, nBTLimit, fCanon, fReverse, vSupp, i ? 0 : fVerbose, Vec_WecEntry(vClasses, iEntry), vSupps );
+        if ( vSop == NULL && fFallback )
+        {
+            // leave the entry empty; the output will keep its multi-level structure
+            continue;
+        }
         if ( vSop == NULL )
             goto finish;
         assert( Vec_IntSize( Vec_WecEntry(vSupps, iCoThis) ) == Abc_SopGetVarNum(Vec_StrArray(vSop)) );
@@ -849,7 +1011,7 @@ Vec_Ptr_t * Abc_GiaDeriveSops( Abc_Ntk_t * pNtkNew, Gia_Man_t * p, Vec_Wec_t * v
     Vec_WecForEachLevel ( vClasses, vClass, i )
         Vec_IntForEachEntry( vClass, iCo, k )
             Vec_PtrWriteEntry( vSops, iCo, Vec_PtrEntry(vSopsRepr, i) );
-    assert( Vec_PtrCountZero(vSops) == 0 );
+    assert( fFallback || Vec_PtrCountZero(vSops) == 0 );
 /*
     // verify
     for ( i = 0; i < Gia_ManCoNum(p); i++ )
@@ -861,13 +1023,39 @@ Vec_Ptr_t * Abc_GiaDeriveSops( Abc_Ntk_t * pNtkNew, Gia_Man_t * p, Vec_Wec_t * v
 */
     // cleanup
 finish:
+    if ( vSopsPar )
+    {
+        Vec_Str_t * vSop;
+        Vec_PtrForEachEntry( Vec_Str_t *, vSopsPar, vSop, i )
+            if ( vSop )
+                Vec_StrFree( vSop );
+        Vec_PtrFree( vSopsPar );
+    }
     ABC_FREE( pOrder );
     Vec_IntFree( vReprs );
     Vec_WecFree( vClasses );
     Vec_PtrFree( vSopsRepr );
     return vSops;
 }
-Abc_Ntk_t * Abc_NtkFromSopsInt( Abc_Ntk_t * pNtk, int nCubeLim, int nBTLimit, int nCostMax, int fCanon, int fReverse, int fCnfShared, int fVerbose )
+Abc_Obj_t * Abc_NtkFromSopsCone_rec( Abc_Ntk_t * pNtkNew, Abc_Obj_t * pObj )
+{
+    int pfCompl[2];
+    if ( pObj->pCopy )
+        return pObj->pCopy;
+    assert( Abc_ObjIsNode(pObj) );
+    if ( Abc_AigNodeIsConst(pObj) )
+        return (pObj->pCopy = Abc_NtkCreateNodeConst1( pNtkNew ));
+    Abc_NtkFromSopsCone_rec( pNtkNew, Abc_ObjFanin0(pObj) );
+    Abc_NtkFromSopsCone_rec( pNtkNew, Abc_ObjFanin1(pObj) );
+    pfCompl[0] = Abc_ObjFaninC0(pObj);
+    pfCompl[1] = Abc_ObjFaninC1(pObj);
+    pObj->pCopy = Abc_NtkCreateNode( pNtkNew );
+    Abc_ObjAddFanin( pObj->pCopy, Abc_ObjFanin0(pObj)->pCopy );
+    Abc_ObjAddFanin( pObj->pCopy, Abc_ObjFanin1(pObj)->pCopy );
+    pObj->pCopy->pData = Abc_SopCreateAnd( (Mem_Flex_t *)pNtkNew->pManFunc, 2, pfCompl );
+    return pObj->pCopy;
+}
+Abc_Ntk_t * Abc_NtkFromSopsInt( Abc_Ntk_t * pNtk, int nCubeLim, int nBTLimit, int nCostMax, int fCanon, int fReverse, int fCnfShared, int nProcs, int fFallback, int fVerbose )
 {
     Abc_Ntk_t * pNtkNew;
     Gia_Man_t * pGia;
@@ -875,11 +1063,11 @@ Abc_Ntk_t * Abc_NtkFromSopsInt( Abc_Ntk_t * pNtk, int nCubeLim, int nBTLimit, in
     Vec_Int_t * vSupp;
     Vec_Ptr_t * vSops;
     Abc_Obj_t * pNode, * pNodeNew, * pDriver;
-    int i, k, iCi; 
+    int i, k, iCi, nFallback = 0;
     pGia    = Abc_NtkClpGia( pNtk );
     vSupps  = Gia_ManCreateCoSupps( pGia, fVerbose );
     // check the largest output
-    if ( nCubeLim > 0 && nCostMax > 0 )
+    if ( nCubeLim > 0 && nCostMax > 0 && !fFallback )
     {
         int iCoMax   = Gia_ManCoLargestSupp( pGia, vSupps );
         int iObjMax  = Gia_ObjId( pGia, Gia_ManCo(pGia, iCoMax) );
@@ -896,7 +1084,7 @@ Abc_Ntk_t * Abc_NtkFromSopsInt( Abc_Ntk_t * pNtk, int nCubeLim, int nBTLimit, in
         }
     }
     pNtkNew = Abc_NtkStartFrom( pNtk, ABC_NTK_LOGIC, ABC_FUNC_SOP );
-    vSops   = Abc_GiaDeriveSops( pNtkNew, pGia, vSupps, nCubeLim, nBTLimit, nCostMax, fCanon, fReverse, fCnfShared, fVerbose );
+    vSops   = Abc_GiaDeriveSops( pNtkNew, pGia, vSupps, nCubeLim, nBTLimit, nCostMax, fCanon, fReverse, fCnfShared, nProcs, fFallback, fVerbose );
     Gia_ManStop( pGia );
     if ( vSops == NULL )
     {
@@ -927,6 +1115,17 @@ Abc_Ntk_t * Abc_NtkFromSopsInt( Abc_Ntk_t * pNtk, int nCubeLim, int nBTLimit, in
             Abc_ObjAddFanin( pNode->pCopy, pNodeNew );
             continue;
         }
+        if ( Vec_PtrEntry( vSops, i ) == NULL )
+        {
+            // the SOP was not computed; copy the AIG cone of this output
+            assert( fFallback );
+            nFallback++;
+            pNodeNew = Abc_NtkFromSopsCone_rec( pNtkNew, pDriver );
+            if ( Abc_ObjFaninC0(pNode) )
+                pNodeNew = Abc_NtkCreateNodeInv( pNtkNew, pNodeNew );
+            Abc_ObjAddFanin( pNode->pCopy, pNodeNew );
+            continue;
+        }
         pNodeNew = Abc_NtkCreateNode( pNtkNew );
         vSupp = Vec_WecEntry( vSupps, i );
         Vec_IntForEachEntry( vSupp, iCi, k )
@@ -935,16 +1134,18 @@ Abc_Ntk_t * Abc_NtkFromSopsInt( Abc_Ntk_t * pNtk, int nCubeLim, int nBTLimit, in
         assert( pNodeNew->pData != (void *)(ABC_PTRINT_T)1 );
         Abc_ObjAddFanin( pNode->pCopy, pNodeNew );
     }
+    if ( nFallback )
+        Abc_Print( 0, "%d out of %d outputs exceeded the limits and were not collapsed (their AIG cones are kept).\n", nFallback, Abc_NtkCoNum(pNtk) );
     Vec_WecFree( vSupps );
     Vec_PtrFree( vSops );
     Abc_NtkSortSops( pNtkNew );
     return pNtkNew;
 }
-Abc_Ntk_t * Abc_NtkCollapseSat( Abc_Ntk_t * pNtk, int nCubeLim, int nBTLimit, int nCostMax, int fCanon, int fReverse, int fCnfShared, int fVerbose )
+Abc_Ntk_t * Abc_NtkCollapseSat( Abc_Ntk_t * pNtk, int nCubeLim, int nBTLimit, int nCostMax, int fCanon, int fReverse, int fCnfShared, int nProcs, int fFallback, int fVerbose )
 {
     Abc_Ntk_t * pNtkNew;
     assert( Abc_NtkIsStrash(pNtk) );
-    pNtkNew = Abc_NtkFromSopsInt( pNtk, nCubeLim, nBTLimit, nCostMax, fCanon, fReverse, fCnfShared, fVerbose );
+    pNtkNew = Abc_NtkFromSopsInt( pNtk, nCubeLim, nBTLimit, nCostMax, fCanon, fReverse, fCnfShared, nProcs, fFallback, fVerbose );
     if ( pNtkNew == NULL )
         return NULL;
     if ( pNtk->pExdc )
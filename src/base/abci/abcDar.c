@@ -1531,7 +1531,13 @@ Abc_Ntk_t * Abc_NtkDRewrite( Abc_Ntk_t * pNtk, Dar_RwrPar_t * pPars )
         Vec_VecFree( vParts );
     }
 */
-    Dar_ManRewrite( pMan, pPars );
+    if ( pPars->nProcs > 1 )
+    {
+        pMan = Dar_ManRewriteWindows( pTemp = pMan, pPars );
+        Aig_ManStop( pTemp );
+    }
+    else
+        Dar_ManRewrite( pMan, pPars );
 //    pMan = Dar_ManBalance( pTemp = pMan, pPars->fUpdateLevel );
 //    Aig_ManStop( pTemp );
 
@@ -1546,6 +1552,38 @@ clk = Abc_Clock();
     return pNtkAig;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs batch rewriting using the precomputed NPN library.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Abc_NtkRewriteBatch( Abc_Ntk_t * pNtk, int fUpdateLevel, int fUseZeros, int fVerbose )
+{
+    extern Gia_Man_t * Rwr_ManRewriteGia( Gia_Man_t * p, int fUpdateLevel, int fUseZeros, int fVerbose );
+    Gia_Man_t * pGia, * pTemp;
+    Aig_Man_t * pMan;
+    Abc_Ntk_t * pNtkAig;
+    assert( Abc_NtkIsStrash(pNtk) );
+    pMan = Abc_NtkToDar( pNtk, 0, 0 );
+    if ( pMan == NULL )
+        return NULL;
+    pGia = Gia_ManFromAig( pMan );
+    Aig_ManStop( pMan );
+    pGia = Rwr_ManRewriteGia( pTemp = pGia, fUpdateLevel, fUseZeros, fVerbose );
+    Gia_ManStop( pTemp );
+    pMan = Gia_ManToAig( pGia, 0 );
+    Gia_ManStop( pGia );
+    pNtkAig = Abc_NtkFromDar( pNtk, pMan );
+    Aig_ManStop( pMan );
+    return pNtkAig;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Gives the current ABC network to AIG manager for processing.]
@@ -1835,11 +1873,22 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
     if ( fVerbose )
     Aig_ManPrintStats( pMan );
 
+    // write CNF directly into the file without collecting the clauses
+    if ( !fFastAlgo )
+    {
+        int nVars = 0, nClauses = 0, nLiterals = 0;
+        if ( Cnf_DeriveToFile( pMan, 0, fChangePol, pFileName, &nVars, &nClauses, &nLiterals ) )
+        {
+            Abc_Print( 1, "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d.   ", nVars, nClauses, nLiterals );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        Cnf_ManFree();
+        Aig_ManStop( pMan );
+        return pNtkNew;
+    }
+
     // derive CNF
-    if ( fFastAlgo )
-        pCnf = Cnf_DeriveFast( pMan, 0 );
-    else
-        pCnf = Cnf_Derive( pMan, 0 );
+    pCnf = Cnf_DeriveFast( pMan, 0 );
 
     // adjust polarity
     if ( fChangePol )
@@ -3045,7 +3094,7 @@ int Abc_NtkDarSec( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, Fra_Sec_t * pSecPar )
 int Abc_NtkDarPdr( Abc_Ntk_t * pNtk, Pdr_Par_t * pPars )
 {
     int RetValue = -1;
-    abctime clk = Abc_Clock();
+    abctime clk = Abc_Clock(), clkWall = Abc_ClockWall();
     Aig_Man_t * pMan;
     pMan = Abc_NtkToDar( pNtk, 0, 1 );
     if ( pMan == NULL )
@@ -3080,7 +3129,8 @@ int Abc_NtkDarPdr( Abc_Ntk_t * pNtk, Pdr_Par_t * pPars )
             else
                 assert( 0 );
         }
-        ABC_PRT( "Time", Abc_Clock() - clk );
+        // the concurrent workers do not run in this thread
+        ABC_PRT( "Time", pPars->nProcs > 1 ? Abc_ClockWall() - clkWall : Abc_Clock() - clk );
 /*
         Abc_Print( 1, "Status: " );
         if ( pPars->pOutMap )
@@ -3109,6 +3159,38 @@ int Abc_NtkDarPdr( Abc_Ntk_t * pNtk, Pdr_Par_t * pPars )
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Runs the portfolio of sequential engines.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkDarProvePortfolio( Abc_Ntk_t * pNtk, int nTimeOut, int fVerbose )
+{
+    Gia_Man_t * pGia;
+    Aig_Man_t * pMan;
+    int RetValue;
+    pMan = Abc_NtkToDar( pNtk, 0, 1 );
+    if ( pMan == NULL )
+    {
+        Abc_Print( 1, "Converting network into AIG has failed.\n" );
+        return -1;
+    }
+    pGia = Gia_ManFromAigSimple( pMan );
+    Aig_ManStop( pMan );
+    RetValue = Cec_GiaProvePortfolio( pGia, nTimeOut, fVerbose );
+    ABC_FREE( pNtk->pSeqModel );
+    pNtk->pSeqModel = pGia->pCexSeq;
+    pGia->pCexSeq = NULL;
+    Gia_ManStop( pGia );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs BDD-based reachability analysis.]
@@ -57,6 +57,7 @@ static int IoCommandReadStatus  ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandReadGig     ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandReadJson    ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandReadSF      ( Abc_Frame_t * pAbc, int argc, char **argv );
+static int IoCommandLoadSession ( Abc_Frame_t * pAbc, int argc, char **argv );
 
 static int IoCommandWrite       ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteHie    ( Abc_Frame_t * pAbc, int argc, char **argv );
@@ -84,6 +85,7 @@ static int IoCommandWriteTruths ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteStatus ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteSmv    ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteJson   ( Abc_Frame_t * pAbc, int argc, char **argv );
+static int IoCommandSaveSession ( Abc_Frame_t * pAbc, int argc, char **argv );
 
 extern void Abc_FrameCopyLTLDataBase( Abc_Frame_t *pAbc, Abc_Ntk_t * pNtk );
 
@@ -127,6 +129,7 @@ void Io_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "I/O", "&read_gig",     IoCommandReadGig,      0 );
     Cmd_CommandAdd( pAbc, "I/O", "read_json",     IoCommandReadJson,     0 );
     Cmd_CommandAdd( pAbc, "I/O", "read_sf",       IoCommandReadSF,       0 );
+    Cmd_CommandAdd( pAbc, "I/O", "load_session",  IoCommandLoadSession,  1 );
 
     Cmd_CommandAdd( pAbc, "I/O", "write",         IoCommandWrite,        0 );
     Cmd_CommandAdd( pAbc, "I/O", "write_hie",     IoCommandWriteHie,     0 );
@@ -155,6 +158,7 @@ void Io_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "I/O", "write_status",  IoCommandWriteStatus,  0 );
     Cmd_CommandAdd( pAbc, "I/O", "write_smv",     IoCommandWriteSmv,     0 );
     Cmd_CommandAdd( pAbc, "I/O", "write_json",    IoCommandWriteJson,    0 );
+    Cmd_CommandAdd( pAbc, "I/O", "save_session",  IoCommandSaveSession,  0 );
 }
 
 /**Function*************************************************************
@@ -484,6 +488,7 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fCheck;
     int fUseNewParser;
     int fSaveNames;
+    int nProcs;
     int c;
     extern Abc_Ntk_t * Io_ReadBlifAsAig( char * pFileName, int fCheck );
 
@@ -491,11 +496,23 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     fReadAsAig = 0;
     fUseNewParser = 1;
     fSaveNames = 0;
+    nProcs = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "nmach" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pnmach" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    fprintf( pAbc->Err, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nProcs <= 0 )
+                    goto usage;
+                break;
             case 'n':
                 fUseNewParser ^= 1;
                 break;
@@ -522,7 +539,11 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     if ( fReadAsAig )
         pNtk = Io_ReadBlifAsAig( pFileName, fCheck );
     else if ( fUseNewParser )
+    {
+        Io_ReadBlifMvSetProcs( nProcs );
         pNtk = Io_Read( pFileName, IO_FILE_BLIF, fCheck, 0 );
+        Io_ReadBlifMvSetProcs( 1 );
+    }
     else
     {
         Abc_Ntk_t * pTemp;
@@ -545,9 +566,10 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_blif [-nmach] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_blif [-P num] [-nmach] <file>\n" );
     fprintf( pAbc->Err, "\t         reads the network in binary BLIF format\n" );
     fprintf( pAbc->Err, "\t         (if this command does not work, try \"read\")\n" );
+    fprintf( pAbc->Err, "\t-P num : the number of threads used by the new parser [default = %d]\n", nProcs );
     fprintf( pAbc->Err, "\t-n     : toggle using old BLIF parser without hierarchy support [default = %s]\n", !fUseNewParser? "yes":"no" );
     fprintf( pAbc->Err, "\t-m     : toggle saving original circuit names into a file [default = %s]\n", fSaveNames? "yes":"no" );
     fprintf( pAbc->Err, "\t-a     : toggle creating AIG while reading the file [default = %s]\n", fReadAsAig? "yes":"no" );
@@ -1200,14 +1222,16 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     Abc_Ntk_t * pNtk;
     char * pFileName;
-    int fCheck, fBarBufs;
+    int fCheck, fBarBufs, fVerbose;
     int c;
+    abctime clk;
 
     fCheck = 1;
     fBarBufs = 0;
+    fVerbose = 0;
     glo_fMapped = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "mcbh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "mcbvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -1220,6 +1244,9 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
             case 'b':
                 fBarBufs ^= 1;
                 break;
+            case 'v':
+                fVerbose ^= 1;
+                break;
             case 'h':
                 goto usage;
             default:
@@ -1231,20 +1258,28 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
     // get the input file name
     pFileName = argv[globalUtilOptind];
     // read the file using the corresponding file reader
+    clk = Abc_Clock();
     pNtk = Io_Read( pFileName, IO_FILE_VERILOG, fCheck, fBarBufs );
     if ( pNtk == NULL )
         return 1;
+    if ( fVerbose )
+    {
+        double MBytes = 1.0 * Extra_FileSize(pFileName) / (1<<20);
+        double Time   = 1.0 * (Abc_Clock() - clk) / CLOCKS_PER_SEC;
+        printf( "Read %.2f MB in %.2f sec (%.2f MB/sec).\n", MBytes, Time, Time > 0 ? MBytes / Time : 0.0 );
+    }
     // replace the current network
     Abc_FrameReplaceCurrentNetwork( pAbc, pNtk );
     Abc_FrameClearVerifStatus( pAbc );
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_verilog [-mcbh] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_verilog [-mcbvh] <file>\n" );
     fprintf( pAbc->Err, "\t         reads the network in Verilog (IWLS 2002/2005 subset)\n" );
     fprintf( pAbc->Err, "\t-m     : toggle reading mapped Verilog [default = %s]\n", glo_fMapped? "yes":"no" );
     fprintf( pAbc->Err, "\t-c     : toggle network check after reading [default = %s]\n", fCheck? "yes":"no" );
     fprintf( pAbc->Err, "\t-b     : toggle reading barrier buffers [default = %s]\n", fBarBufs? "yes":"no" );
+    fprintf( pAbc->Err, "\t-v     : toggle printing the reading throughput [default = %s]\n", fVerbose? "yes":"no" );
     fprintf( pAbc->Err, "\t-h     : prints the command summary\n" );
     fprintf( pAbc->Err, "\tfile   : the name of a file to read\n" );
     return 1;
@@ -3465,6 +3500,88 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int IoCommandSaveSession( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    extern int Io_WriteSession( Abc_Frame_t * pAbc, char * pFileName );
+    int c;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "h" ) ) != EOF )
+    {
+        switch ( c )
+        {
+            case 'h':
+                goto usage;
+            default:
+                goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+    if ( !Io_WriteSession( pAbc, argv[globalUtilOptind] ) )
+        return 1;
+    return 0;
+
+usage:
+    fprintf( pAbc->Err, "usage: save_session [-h] <file>\n" );
+    fprintf( pAbc->Err, "\t         saves the current network, the current AIG, and the LUT,\n" );
+    fprintf( pAbc->Err, "\t         genlib, and standard-cell libraries into a binary file\n" );
+    fprintf( pAbc->Err, "\t-h     : print the help message\n" );
+    fprintf( pAbc->Err, "\tfile   : the name of the file to write\n" );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int IoCommandLoadSession( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    extern int Io_ReadSession( Abc_Frame_t * pAbc, char * pFileName );
+    int c;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "h" ) ) != EOF )
+    {
+        switch ( c )
+        {
+            case 'h':
+                goto usage;
+            default:
+                goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+    if ( !Io_ReadSession( pAbc, argv[globalUtilOptind] ) )
+        return 1;
+    return 0;
+
+usage:
+    fprintf( pAbc->Err, "usage: load_session [-h] <file>\n" );
+    fprintf( pAbc->Err, "\t         restores the state saved by \"save_session\"\n" );
+    fprintf( pAbc->Err, "\t         (the parts missing in the file are left unchanged)\n" );
+    fprintf( pAbc->Err, "\t-h     : print the help message\n" );
+    fprintf( pAbc->Err, "\tfile   : the name of the file to read\n" );
+    return 1;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -87,6 +87,8 @@ extern Abc_Ntk_t *        Io_ReadBblif( char * pFileName, int fCheck );
 extern Abc_Ntk_t *        Io_ReadBlif( char * pFileName, int fCheck );
 /*=== abcReadBlifMv.c =========================================================*/
 extern Abc_Ntk_t *        Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck );
+extern void               Io_ReadBlifMvSetProcs( int nProcs );
+extern int                Io_ReadBlifMvReadProcs();
 /*=== abcReadBench.c ==========================================================*/
 extern Abc_Ntk_t *        Io_ReadBench( char * pFileName, int fCheck );
 extern void               Io_ReadBenchInit( Abc_Ntk_t * pNtk, char * pFileName );
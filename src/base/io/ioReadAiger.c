@@ -201,19 +201,16 @@ static char * Ioa_ReadLoadFileGzAig( char * pFileName, int * pFileSize )
     const int READ_BLOCK_SIZE = 100000;
     gzFile pFile;
     char * pContents;
-    int amtRead, readBlock, nFileSize = READ_BLOCK_SIZE;
+    int amtRead, nFileSize = 0, nAlloc = READ_BLOCK_SIZE;
     pFile = gzopen( pFileName, "rb" ); // if pFileName doesn't end in ".gz" then this acts as a passthrough to fopen
-    pContents = ABC_ALLOC( char, nFileSize );        
-    readBlock = 0;
-    while ((amtRead = gzread(pFile, pContents + readBlock * READ_BLOCK_SIZE, READ_BLOCK_SIZE)) == READ_BLOCK_SIZE) {
-        //printf("%d: read %d bytes\n", readBlock, amtRead);
-        nFileSize += READ_BLOCK_SIZE;
-        pContents = ABC_REALLOC(char, pContents, nFileSize);
-        ++readBlock;
+    pContents = ABC_ALLOC( char, nAlloc );        
+    // double the buffer when it is full to avoid quadratic copying for large files
+    while ((amtRead = gzread(pFile, pContents + nFileSize, nAlloc - nFileSize)) > 0) {
+        nFileSize += amtRead;
+        if ( nFileSize == nAlloc )
+            pContents = ABC_REALLOC(char, pContents, (nAlloc *= 2));
     }
-    //printf("%d: read %d bytes\n", readBlock, amtRead);
     assert( amtRead != -1 ); // indicates a zlib error
-    nFileSize -= (READ_BLOCK_SIZE - amtRead);
     gzclose(pFile);
     *pFileSize = nFileSize;
     return pContents;
@@ -24,6 +24,23 @@
 #include "misc/vec/vecPtr.h"
 #include "ioAbc.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -33,9 +50,14 @@ ABC_NAMESPACE_IMPL_START
 #define IO_BLIFMV_MAXVALUES 256
 //#define IO_VERBOSE_OUTPUT
 
+#define IO_BLIFMV_THR_MAX    64         // the max number of threads
+#define IO_BLIFMV_LINES_MIN  10000      // the min number of .names lines per thread
+#define IO_BLIFMV_CHARS_MIN  (1 << 20)  // the min number of characters per thread
+
 typedef struct Io_MvVar_t_ Io_MvVar_t; // parsing var
 typedef struct Io_MvMod_t_ Io_MvMod_t; // parsing model
 typedef struct Io_MvMan_t_ Io_MvMan_t; // parsing manager
+typedef struct Io_MvThData_t_ Io_MvThData_t; // parsing thread
 
 Vec_Ptr_t *vGlobalLtlArray;
 
@@ -76,6 +98,7 @@ struct Io_MvMan_t_
     int                  fUseReset;    // the reset circuitry is added
     char *               pFileName;    // the name of the file
     char *               pBuffer;      // the contents of the file
+    int                  nMapSize;     // the size of the mapping (0 if the file is read into memory)
     Vec_Ptr_t *          vLines;       // the line beginnings
     // the results of reading
     Abc_Des_t *          pDesign;      // the design under construction
@@ -94,12 +117,36 @@ struct Io_MvMan_t_
     int                  nTablesLeft;  // the number of dangling tables
 };
 
+struct Io_MvThData_t_
+{
+    Io_MvMan_t *         pMan;         // the parsing manager
+    // splitting the buffer into lines
+    char *               pBeg;         // the first character of the chunk
+    char *               pEnd;         // the character following the chunk
+    Vec_Ptr_t *          vLines;       // the line beginnings in the chunk
+    // parsing .names lines
+    Vec_Ptr_t *          vNames;       // the .names lines of the model
+    int                  iStart;       // the first line of the chunk
+    int                  iStop;        // the line following the chunk
+    Vec_Int_t *          vLineToks;    // for each line, the first token and the number of tokens
+    Vec_Int_t *          vLineFuncs;   // for each line, the SOP offset (-1 = not parsed; -2 = error)
+    Vec_Ptr_t *          vTokens;      // the tokens of all lines of the chunk
+    Vec_Ptr_t *          vTokens2;     // the tokens of the current table
+    Vec_Str_t *          vFunc;        // the SOPs of all lines of the chunk
+    char                 sError[512];  // the first error in the chunk
+};
+
+// the number of threads used to parse binary BLIF
+static int s_nBlifMvProcs = 1;
+
 // static functions
 static Io_MvMan_t *      Io_MvAlloc();
 static void              Io_MvFree( Io_MvMan_t * p );
 static Io_MvMod_t *      Io_MvModAlloc();
 static void              Io_MvModFree( Io_MvMod_t * p );
 static char *            Io_MvLoadFile( char * pFileName );
+static char *            Io_MvMapFile( char * pFileName, int * pnMapSize );
+static void              Io_MvUnmapFile( char * pContents, int nMapSize );
 static void              Io_MvReadPreparse( Io_MvMan_t * p );
 static int               Io_MvReadInterfaces( Io_MvMan_t * p );
 static Abc_Des_t *       Io_MvParse( Io_MvMan_t * p );
@@ -117,6 +164,7 @@ static int               Io_MvParseLineNamesBlif( Io_MvMod_t * p, char * pLine )
 static int               Io_MvParseLineShortBlif( Io_MvMod_t * p, char * pLine );
 static int                 Io_MvParseLineLtlProperty( Io_MvMod_t * p, char * pLine );
 static int               Io_MvParseLineGateBlif( Io_MvMod_t * p, Vec_Ptr_t * vTokens );
+static int               Io_MvParseNamesBlifPar( Io_MvMod_t * p, int nProcs );
 static Io_MvVar_t *      Abc_NtkMvVarDup( Abc_Ntk_t * pNtk, Io_MvVar_t * pVar );
 
 static int               Io_MvCharIsSpace( char s )  { return s == ' ' || s == '\t' || s == '\r' || s == '\n';  }
@@ -163,7 +211,9 @@ Abc_Ntk_t * Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck )
     p->fBlifMv   = fBlifMv;
     p->fUseReset = 1;
     p->pFileName = pFileName;
-    p->pBuffer   = Io_MvLoadFile( pFileName );
+    p->pBuffer   = Io_MvMapFile( pFileName, &p->nMapSize );
+    if ( p->pBuffer == NULL )
+        p->pBuffer = Io_MvLoadFile( pFileName );
     if ( p->pBuffer == NULL )
     {
         Io_MvFree( p );
@@ -296,7 +346,9 @@ static void Io_MvFree( Io_MvMan_t * p )
     int i;
     if ( p->pDesign )
         Abc_DesFree( p->pDesign, NULL );
-    if ( p->pBuffer )  
+    if ( p->nMapSize )
+        Io_MvUnmapFile( p->pBuffer, p->nMapSize );
+    else if ( p->pBuffer )  
         ABC_FREE( p->pBuffer );
     if ( p->vLines )
         Vec_PtrFree( p->vLines  );
@@ -698,28 +750,152 @@ static char * Io_MvLoadFile( char * pFileName )
 
 /**Function*************************************************************
 
-  Synopsis    [Prepares the parsing.]
+  Synopsis    [Maps the file into memory.]
 
-  Description [Performs several preliminary operations:
-  - Cuts the file buffer into separate lines.
-  - Removes comments and line extenders.
-  - Sorts lines by directives.
-  - Estimates the number of objects.
-  - Allocates room for the objects.
-  - Allocates room for the hash table.]
+  Description [Returns a private copy-on-write mapping of the file, which
+  the parser can modify in place like the buffer returned by Io_MvLoadFile().
+  The spare ".end" line is written past the end of the file into the zeroed 
+  remainder of the last page. Returns NULL if the file is compressed or if 
+  the last page does not have enough room; in this case, the file should be 
+  loaded using Io_MvLoadFile().]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static void Io_MvReadPreparse( Io_MvMan_t * p )
+static char * Io_MvMapFile( char * pFileName, int * pnMapSize )
 {
-    char * pCur, * pPrev;
-    int i, fComment = 0;
-    // parse the buffer into lines and remove comments
-    Vec_PtrPush( p->vLines, p->pBuffer );
-    for ( pCur = p->pBuffer; *pCur; pCur++ )
+#ifndef _WIN32
+    struct stat Stat;
+    char * pContents;
+    long nPageSize = sysconf( _SC_PAGESIZE );
+    int fd;
+    if ( !strncmp(pFileName+strlen(pFileName)-4,".bz2",4) || !strncmp(pFileName+strlen(pFileName)-3,".gz",3) )
+        return NULL;
+    fd = open( pFileName, O_RDONLY );
+    if ( fd < 0 )
+        return NULL;
+    if ( fstat( fd, &Stat ) != 0 || Stat.st_size == 0 || Stat.st_size >= 0x7FFFFFFF || 
+         nPageSize <= 0 || nPageSize - Stat.st_size % nPageSize < 10 )
+    {
+        close( fd );
+        return NULL;
+    }
+    pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return NULL;
+#ifdef MADV_SEQUENTIAL
+    madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+#endif
+    // finish off the file with the spare .end line
+    strcpy( pContents + Stat.st_size, "\n.end\n" );
+    *pnMapSize = (int)Stat.st_size;
+    return pContents;
+#else
+    return NULL;
+#endif
+}
+static void Io_MvUnmapFile( char * pContents, int nMapSize )
+{
+#ifndef _WIN32
+    munmap( pContents, (size_t)nMapSize );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the number of threads used to parse binary BLIF.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Io_ReadBlifMvSetProcs( int nProcs )
+{
+    s_nBlifMvProcs = Abc_MaxInt( 1, Abc_MinInt(nProcs, IO_BLIFMV_THR_MAX) );
+}
+int Io_ReadBlifMvReadProcs()
+{
+    return s_nBlifMvProcs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the parsing threads.]
+
+  Description [Each thread either splits its chunk of the buffer into 
+  lines or parses its range of .names lines, depending on whether the
+  range of lines is given.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_MvSplitLinesChunk( Io_MvThData_t * pData );
+static void Io_MvParseNamesBlifChunk( Io_MvThData_t * pData );
+static void Io_MvRunChunk( Io_MvThData_t * pData )
+{
+    if ( pData->vNames )
+        Io_MvParseNamesBlifChunk( pData );
+    else
+        Io_MvSplitLinesChunk( pData );
+}
+#ifdef ABC_USE_PTHREADS
+static void * Io_MvWorkerThread( void * pArg )
+{
+    Io_MvRunChunk( (Io_MvThData_t *)pArg );
+    pthread_exit( NULL );
+    assert(0);
+    return NULL;
+}
+#endif
+static void Io_MvRunWorkers( Io_MvThData_t * pThData, int nProcs )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[IO_BLIFMV_THR_MAX];
+    int i, status;
+    assert( nProcs <= IO_BLIFMV_THR_MAX );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Io_MvWorkerThread, (void *)(pThData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+#else
+    int i;
+    for ( i = 0; i < nProcs; i++ )
+        Io_MvRunChunk( pThData + i );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cuts the file buffer into lines and removes comments.]
+
+  Description [The chunk should start at the beginning of a line. The
+  beginnings of the lines following the newlines of the chunk are 
+  collected.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_MvSplitLinesChunk( Io_MvThData_t * pData )
+{
+    char * pCur;
+    int fComment = 0;
+    for ( pCur = pData->pBeg; pCur < pData->pEnd; pCur++ )
     {
         if ( *pCur == '\n' )
         {
@@ -727,7 +903,7 @@ static void Io_MvReadPreparse( Io_MvMan_t * p )
 //            if ( *(pCur-1) == '\r' )
 //                *(pCur-1) = 0;
             fComment = 0;
-            Vec_PtrPush( p->vLines, pCur + 1 );
+            Vec_PtrPush( pData->vLines, pCur + 1 );
         }
         else if ( *pCur == '#' )
             fComment = 1;
@@ -735,6 +911,60 @@ static void Io_MvReadPreparse( Io_MvMan_t * p )
         if ( fComment )
             *pCur = 0;
     }
+}
+static void Io_MvSplitLines( Io_MvMan_t * p )
+{
+    Io_MvThData_t ThData[IO_BLIFMV_THR_MAX];
+    char * pEnd = p->pBuffer + strlen(p->pBuffer);
+    int i, nChars = (int)(pEnd - p->pBuffer);
+    int nProcs = Abc_MaxInt( 1, Abc_MinInt(s_nBlifMvProcs, nChars / IO_BLIFMV_CHARS_MIN) );
+    Vec_PtrPush( p->vLines, p->pBuffer );
+    memset( ThData, 0, sizeof(Io_MvThData_t) * nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pMan = p;
+        ThData[i].pBeg = i ? ThData[i-1].pEnd : p->pBuffer;
+        ThData[i].pEnd = i < nProcs - 1 ? p->pBuffer + (long)nChars * (i + 1) / nProcs : pEnd;
+        // the chunk ends after a newline
+        if ( ThData[i].pEnd < ThData[i].pBeg )
+            ThData[i].pEnd = ThData[i].pBeg;
+        while ( ThData[i].pEnd < pEnd && ThData[i].pEnd > ThData[i].pBeg && ThData[i].pEnd[-1] != '\n' )
+            ThData[i].pEnd++;
+        ThData[i].vLines = nProcs == 1 ? p->vLines : Vec_PtrAlloc( nChars / nProcs / 16 + 16 );
+    }
+    Io_MvRunWorkers( ThData, nProcs );
+    if ( nProcs == 1 )
+        return;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Vec_PtrAppend( p->vLines, ThData[i].vLines );
+        Vec_PtrFree( ThData[i].vLines );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the parsing.]
+
+  Description [Performs several preliminary operations:
+  - Cuts the file buffer into separate lines.
+  - Removes comments and line extenders.
+  - Sorts lines by directives.
+  - Estimates the number of objects.
+  - Allocates room for the objects.
+  - Allocates room for the hash table.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_MvReadPreparse( Io_MvMan_t * p )
+{
+    char * pCur, * pPrev;
+    int i;
+    // parse the buffer into lines and remove comments
+    Io_MvSplitLines( p );
 
     // unfold the line extensions and sort lines by directive
     Vec_PtrForEachEntry( char *, p->vLines, pCur, i )
@@ -954,6 +1184,14 @@ static Abc_Des_t * Io_MvParse( Io_MvMan_t * p )
                 if ( !Io_MvParseLineNamesMv( pMod, pLine, 0 ) )
                     return NULL;
         }
+        else if ( s_nBlifMvProcs > 1 && Vec_PtrSize(pMod->vNames) >= 2 * IO_BLIFMV_LINES_MIN )
+        {
+            if ( !Io_MvParseNamesBlifPar( pMod, s_nBlifMvProcs ) )
+                return NULL;
+            Vec_PtrForEachEntry( char *, pMod->vShorts, pLine, k )
+                if ( !Io_MvParseLineShortBlif( pMod, pLine ) )
+                    return NULL;
+        }
         else
         {
             Vec_PtrForEachEntry( char *, pMod->vNames, pLine, k )
@@ -1990,65 +2228,70 @@ static int Io_MvParseLineNamesMv( Io_MvMod_t * p, char * pLine, int fReset )
 
   Synopsis    [Constructs the SOP cover from the file parsing info.]
 
-  Description []
+  Description [Appends the SOP cover, including the terminating zero, to 
+  vFunc. Only reads the manager, so it can be called by several threads 
+  working on different tables. Returns 0 and writes the error message into 
+  sError if the table is incorrect.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static char * Io_MvParseTableBlif( Io_MvMod_t * p, char * pTable, int nFanins )
+static int Io_MvParseTableBlifInt( Io_MvMan_t * pMan, Vec_Ptr_t * vTokens, Vec_Str_t * vFunc, char * pTable, int nFanins, char * sError )
 {
-    Vec_Ptr_t * vTokens = p->pMan->vTokens;
-    Vec_Str_t * vFunc = p->pMan->vFunc;
     char * pProduct, * pOutput, c;
     int i, Polarity = -1;
 
-    p->pMan->nTablesRead++;
     // get the tokens
     Io_MvSplitIntoTokens( vTokens, pTable, '.' );
     if ( Vec_PtrSize(vTokens) == 0 )
-        return Abc_SopCreateConst0( (Mem_Flex_t *)p->pNtk->pManFunc );
+    {
+        Vec_StrPrintStr( vFunc, " 0\n" );
+        Vec_StrPush( vFunc, '\0' );
+        return 1;
+    }
     if ( Vec_PtrSize(vTokens) == 1 )
     {
         pOutput = (char *)Vec_PtrEntry( vTokens, 0 );
         c = pOutput[0];
         if ( (c!='0'&&c!='1'&&c!='x'&&c!='n') || pOutput[1] )
         {
-            sprintf( p->pMan->sError, "Line %d: Constant table has wrong output value \"%s\".", Io_MvGetLine(p->pMan, pOutput), pOutput );
-            return NULL;
+            sprintf( sError, "Line %d: Constant table has wrong output value \"%s\".", Io_MvGetLine(pMan, pOutput), pOutput );
+            return 0;
         }
-        return pOutput[0] == '0' ? Abc_SopCreateConst0((Mem_Flex_t *)p->pNtk->pManFunc) : Abc_SopCreateConst1((Mem_Flex_t *)p->pNtk->pManFunc);
+        Vec_StrPrintStr( vFunc, pOutput[0] == '0' ? " 0\n" : " 1\n" );
+        Vec_StrPush( vFunc, '\0' );
+        return 1;
     }
     pProduct = (char *)Vec_PtrEntry( vTokens, 0 );
     if ( Vec_PtrSize(vTokens) % 2 == 1 )
     {
-        sprintf( p->pMan->sError, "Line %d: Table has odd number of tokens (%d).", Io_MvGetLine(p->pMan, pProduct), Vec_PtrSize(vTokens) );
-        return NULL;
+        sprintf( sError, "Line %d: Table has odd number of tokens (%d).", Io_MvGetLine(pMan, pProduct), Vec_PtrSize(vTokens) );
+        return 0;
     }
     // parse the table
-    Vec_StrClear( vFunc );
     for ( i = 0; i < Vec_PtrSize(vTokens)/2; i++ )
     {
         pProduct = (char *)Vec_PtrEntry( vTokens, 2*i + 0 );
         pOutput  = (char *)Vec_PtrEntry( vTokens, 2*i + 1 );
         if ( strlen(pProduct) != (unsigned)nFanins )
         {
-            sprintf( p->pMan->sError, "Line %d: Cube \"%s\" has size different from the fanin count (%d).", Io_MvGetLine(p->pMan, pProduct), pProduct, nFanins );
-            return NULL;
+            sprintf( sError, "Line %d: Cube \"%s\" has size different from the fanin count (%d).", Io_MvGetLine(pMan, pProduct), pProduct, nFanins );
+            return 0;
         }
         c = pOutput[0];
         if ( (c!='0'&&c!='1'&&c!='x'&&c!='n') || pOutput[1] )
         {
-            sprintf( p->pMan->sError, "Line %d: Output value \"%s\" is incorrect.", Io_MvGetLine(p->pMan, pProduct), pOutput );
-            return NULL;
+            sprintf( sError, "Line %d: Output value \"%s\" is incorrect.", Io_MvGetLine(pMan, pProduct), pOutput );
+            return 0;
         }
         if ( Polarity == -1 )
             Polarity = (c=='1' || c=='x');
         else if ( Polarity != (c=='1' || c=='x') )
         {
-            sprintf( p->pMan->sError, "Line %d: Output value \"%s\" differs from the value in the first line of the table (%d).", Io_MvGetLine(p->pMan, pProduct), pOutput, Polarity );
-            return NULL;
+            sprintf( sError, "Line %d: Output value \"%s\" differs from the value in the first line of the table (%d).", Io_MvGetLine(pMan, pProduct), pOutput, Polarity );
+            return 0;
         }
         // parse one product 
         Vec_StrPrintStr( vFunc, pProduct );
@@ -2057,7 +2300,15 @@ static char * Io_MvParseTableBlif( Io_MvMod_t * p, char * pTable, int nFanins )
         Vec_StrPush( vFunc, '\n' );
     }
     Vec_StrPush( vFunc, '\0' );
-    return Vec_StrArray( vFunc );
+    return 1;
+}
+static char * Io_MvParseTableBlif( Io_MvMod_t * p, char * pTable, int nFanins )
+{
+    p->pMan->nTablesRead++;
+    Vec_StrClear( p->pMan->vFunc );
+    if ( !Io_MvParseTableBlifInt( p->pMan, p->pMan->vTokens, p->pMan->vFunc, pTable, nFanins, p->pMan->sError ) )
+        return NULL;
+    return Vec_StrArray( p->pMan->vFunc );
 }
 
 /**Function*************************************************************
@@ -2100,6 +2351,133 @@ static int Io_MvParseLineNamesBlif( Io_MvMod_t * p, char * pLine )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Parses a range of .names lines without changing the network.]
+
+  Description [Splits each line into tokens and derives the SOP of its
+  table. The tokens and the SOPs are stored in the buffers of the thread,
+  while their locations are recorded for each line. The lines, which do 
+  not start with "names" (such as .gate lines), are left for the serial 
+  pass. Parsing of the range stops at the first error, which is reported
+  by the linking pass, unless it finds an error in an earlier line.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_MvParseNamesBlifChunk( Io_MvThData_t * pData )
+{
+    Vec_Ptr_t * vTokens = Vec_PtrAlloc( 100 );
+    char * pLine, * pName;
+    int i, iFunc;
+    for ( i = pData->iStart; i < pData->iStop; i++ )
+    {
+        pLine = (char *)Vec_PtrEntry( pData->vNames, i );
+        if ( strncmp(pLine, "names", 5) || !Io_MvCharIsSpace(pLine[5]) )
+            continue;
+        Io_MvSplitIntoTokens( vTokens, pLine, '\0' );
+        Vec_IntWriteEntry( pData->vLineToks, 2*i+0, Vec_PtrSize(pData->vTokens) );
+        Vec_IntWriteEntry( pData->vLineToks, 2*i+1, Vec_PtrSize(vTokens) );
+        Vec_PtrAppend( pData->vTokens, vTokens );
+        // parse the table of this node
+        pName = (char *)Vec_PtrEntryLast( vTokens );
+        iFunc = Vec_StrSize( pData->vFunc );
+        if ( !Io_MvParseTableBlifInt( pData->pMan, pData->vTokens2, pData->vFunc, pName + strlen(pName), Abc_MaxInt(0, Vec_PtrSize(vTokens) - 2), pData->sError ) )
+        {
+            Vec_IntWriteEntry( pData->vLineFuncs, i, -2 );
+            break;
+        }
+        Vec_IntWriteEntry( pData->vLineFuncs, i, iFunc );
+    }
+    Vec_PtrFree( vTokens );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the .names lines of the model using several threads.]
+
+  Description [The lines are divided into ranges, which are tokenized and
+  parsed in parallel by Io_MvParseNamesBlifChunk(). The nodes are then 
+  created in the original order by the serial linking pass, which is the 
+  only one looking up and creating the nets, so the resulting network is
+  the same as the one produced by Io_MvParseLineNamesBlif().]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_MvParseNamesBlifPar( Io_MvMod_t * p, int nProcs )
+{
+    Io_MvThData_t ThData[IO_BLIFMV_THR_MAX];
+    Vec_Int_t * vLineToks, * vLineFuncs;
+    Abc_Obj_t * pNet, * pNode;
+    char ** pTokens, * pLine, * pName;
+    int i, k, nLines = Vec_PtrSize(p->vNames), nChunk, nToks, iFunc, RetValue = 0;
+    assert( !p->pMan->fBlifMv );
+    nProcs = Abc_MaxInt( 1, Abc_MinInt(nProcs, nLines / IO_BLIFMV_LINES_MIN) );
+    nChunk = (nLines + nProcs - 1) / nProcs;
+    vLineToks  = Vec_IntStart( 2 * nLines );
+    vLineFuncs = Vec_IntStartFull( nLines );
+    memset( ThData, 0, sizeof(Io_MvThData_t) * nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pMan       = p->pMan;
+        ThData[i].vNames     = p->vNames;
+        ThData[i].iStart     = Abc_MinInt( i * nChunk, nLines );
+        ThData[i].iStop      = Abc_MinInt( (i + 1) * nChunk, nLines );
+        ThData[i].vLineToks  = vLineToks;
+        ThData[i].vLineFuncs = vLineFuncs;
+        ThData[i].vTokens    = Vec_PtrAlloc( 4 * (ThData[i].iStop - ThData[i].iStart) + 16 );
+        ThData[i].vTokens2   = Vec_PtrAlloc( 100 );
+        ThData[i].vFunc      = Vec_StrAlloc( 16 * (ThData[i].iStop - ThData[i].iStart) + 16 );
+    }
+    Io_MvRunWorkers( ThData, nProcs );
+    // link the nodes in the original order
+    Vec_PtrForEachEntry( char *, p->vNames, pLine, i )
+    {
+        k = i / nChunk;
+        iFunc = Vec_IntEntry( vLineFuncs, i );
+        if ( iFunc == -1 )
+        {
+            if ( !Io_MvParseLineNamesBlif( p, pLine ) )
+                goto finish;
+            continue;
+        }
+        pTokens = (char **)Vec_PtrArray(ThData[k].vTokens) + Vec_IntEntry(vLineToks, 2*i);
+        nToks   = Vec_IntEntry( vLineToks, 2*i+1 );
+        pName   = pTokens[nToks-1];
+        pNet = Abc_NtkFindOrCreateNet( p->pNtk, pName );
+        if ( Abc_ObjFaninNum(pNet) > 0 )
+        {
+            sprintf( p->pMan->sError, "Line %d: Signal \"%s\" is defined more than once.", Io_MvGetLine(p->pMan, pName), pName );
+            goto finish;
+        }
+        if ( iFunc == -2 )
+        {
+            strcpy( p->pMan->sError, ThData[k].sError );
+            goto finish;
+        }
+        // create fanins
+        pNode = Io_ReadCreateNode( p->pNtk, pName, pTokens + 1, nToks - 2 );
+        pNode->pData = Abc_SopRegister( (Mem_Flex_t *)p->pNtk->pManFunc, Vec_StrEntryP(ThData[k].vFunc, iFunc) );
+        p->pMan->nTablesRead++;
+    }
+    RetValue = 1;
+finish:
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Vec_PtrFree( ThData[i].vTokens );
+        Vec_PtrFree( ThData[i].vTokens2 );
+        Vec_StrFree( ThData[i].vFunc );
+    }
+    Vec_IntFree( vLineToks );
+    Vec_IntFree( vLineFuncs );
+    return RetValue;
+}
+
 ABC_NAMESPACE_IMPL_END
 
 #include "map/mio/mio.h"
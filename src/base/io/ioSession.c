@@ -0,0 +1,974 @@
+/**CFile****************************************************************
+
+  FileName    [ioSession.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Saving and restoring the state of the ABC frame.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: ioSession.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "ioAbc.h"
+#include "base/main/mainInt.h"
+#include "map/mio/mio.h"
+#include "map/if/if.h"
+#include "map/scl/sclLib.h"
+#include "map/amap/amap.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+/*
+    The session file starts with the magic string "abc-session" followed
+    by the zero byte and the format version (4 bytes, MSB first).
+    Next come the sections, each of them composed of the one-character tag,
+    the payload size (4 bytes, MSB first), and the payload:
+        'L' - the LUT library
+        'S' - the standard-cell library (in the binary format of read_scl)
+        'G' - the genlib library (as text)
+        'N' - the current network, including the mapping and the timing
+        'A' - the current AIG of the &-space (in AIGER with all extensions)
+        '.' - the end of the file
+    The sections are read in this order, so that the network is restored
+    after the library it is mapped into. The sections with unknown tags
+    are skipped, which allows for adding new sections without changing
+    the version. The payload is decoded in place, without copying the file.
+    All sections are decoded before any of them is installed in the frame,
+    so that a corrupted or truncated file leaves the frame unchanged.
+*/
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define IO_SESSION_MAGIC    "abc-session"
+#define IO_SESSION_VERSION  1
+
+// the readers below never access the data past the end of the buffer;
+// if the data is truncated, they return zero (or the empty string) and
+// move the position past the end, which is detected by the caller
+static inline int Io_SesFail( Vec_Str_t * vIn, int * pPos )
+{
+    *pPos = Vec_StrSize(vIn) + 1;
+    return 0;
+}
+static inline int Io_SesIsOk( Vec_Str_t * vIn, int Pos )
+{
+    return Pos <= Vec_StrSize(vIn);
+}
+// returns the string stored in the buffer without copying it
+static inline char * Io_SesGetS( Vec_Str_t * vIn, int * pPos )
+{
+    char * pStr, * pEnd;
+    if ( *pPos >= Vec_StrSize(vIn) )
+    {
+        Io_SesFail( vIn, pPos );
+        return (char *)"";
+    }
+    pStr = Vec_StrEntryP( vIn, *pPos );
+    pEnd = (char *)memchr( pStr, 0, (size_t)(Vec_StrSize(vIn) - *pPos) );
+    if ( pEnd == NULL )
+    {
+        Io_SesFail( vIn, pPos );
+        return (char *)"";
+    }
+    *pPos += (int)(pEnd - pStr) + 1;
+    return pStr;
+}
+static inline int Io_SesGetI( Vec_Str_t * vIn, int * pPos )
+{
+    unsigned Val = 0;
+    unsigned char ch;
+    int i;
+    for ( i = 0; i < 5 && *pPos < Vec_StrSize(vIn); i++ )
+    {
+        ch = (unsigned char)Vec_StrEntry( vIn, (*pPos)++ );
+        Val |= (unsigned)(ch & 0x7f) << (7 * i);
+        if ( !(ch & 0x80) )
+            return (int)Val;
+    }
+    return Io_SesFail( vIn, pPos );
+}
+static inline float Io_SesGetF( Vec_Str_t * vIn, int * pPos )
+{
+    if ( *pPos > Vec_StrSize(vIn) - 4 )
+        return (float)Io_SesFail( vIn, pPos );
+    return Vec_StrGetF( vIn, pPos );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Saves and restores the LUT library.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Io_SesWriteLibLut( Vec_Str_t * vOut, If_LibLut_t * p )
+{
+    int i, k;
+    Vec_StrPutS( vOut, p->pName ? p->pName : (char *)"" );
+    Vec_StrPutI( vOut, p->LutMax );
+    Vec_StrPutI( vOut, p->fVarPinDelays );
+    for ( i = 0; i <= p->LutMax; i++ )
+        Vec_StrPutF( vOut, p->pLutAreas[i] );
+    for ( i = 0; i <= p->LutMax; i++ )
+        for ( k = 0; k <= p->LutMax; k++ )
+            Vec_StrPutF( vOut, p->pLutDelays[i][k] );
+}
+If_LibLut_t * Io_SesReadLibLut( Vec_Str_t * vIn )
+{
+    If_LibLut_t * p = ABC_CALLOC( If_LibLut_t, 1 );
+    int i, k, Pos = 0;
+    p->pName         = Abc_UtilStrsav( Io_SesGetS(vIn, &Pos) );
+    p->LutMax        = Io_SesGetI( vIn, &Pos );
+    p->fVarPinDelays = Io_SesGetI( vIn, &Pos );
+    if ( p->LutMax < 1 || p->LutMax > IF_MAX_LUTSIZE )
+    {
+        If_LibLutFree( p );
+        return NULL;
+    }
+    for ( i = 0; i <= p->LutMax; i++ )
+        p->pLutAreas[i] = Io_SesGetF( vIn, &Pos );
+    for ( i = 0; i <= p->LutMax; i++ )
+        for ( k = 0; k <= p->LutMax; k++ )
+            p->pLutDelays[i][k] = Io_SesGetF( vIn, &Pos );
+    if ( Pos != Vec_StrSize(vIn) )
+    {
+        If_LibLutFree( p );
+        return NULL;
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves and restores the genlib library.]
+
+  Description [The library is saved as the text, which is parsed when
+  the session is loaded. The first string is the library name. The reader
+  returns the parsed library and its version for the area-oriented mapper
+  without installing them in the frame.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_SesWriteLibGen( Vec_Str_t * vOut, Mio_Library_t * pLib )
+{
+    FILE * pFile = tmpfile();
+    char * pBuffer;
+    int nSize;
+    if ( pFile == NULL )
+        return 0;
+    Mio_WriteLibrary( pFile, pLib, 0, 0, 0 );
+    nSize = (int)ftell( pFile );
+    rewind( pFile );
+    pBuffer = ABC_ALLOC( char, nSize + 1 );
+    nSize = (int)fread( pBuffer, 1, (size_t)nSize, pFile );
+    fclose( pFile );
+    pBuffer[nSize] = 0;
+    Vec_StrPutS( vOut, Mio_LibraryReadName(pLib) );
+    Vec_StrPutS( vOut, pBuffer );
+    ABC_FREE( pBuffer );
+    return 1;
+}
+Mio_Library_t * Io_SesReadLibGen( Vec_Str_t * vIn, Amap_Lib_t ** ppLib2 )
+{
+    Mio_Library_t * pLib = NULL;
+    Vec_Str_t * vStr, * vStr2;
+    int Pos = 0;
+    char * pName = Io_SesGetS( vIn, &Pos );
+    char * pText = Io_SesGetS( vIn, &Pos );
+    *ppLib2 = NULL;
+    if ( Pos != Vec_StrSize(vIn) )
+        return NULL;
+    // the parsers modify the buffer, so each of them gets its own copy
+    vStr = Vec_StrAlloc( (int)strlen(pText) + 10 );
+    Vec_StrPrintStr( vStr, pText );
+    Vec_StrPrintStr( vStr, "\n.end\n" );
+    Vec_StrPush( vStr, '\0' );
+    vStr2 = Vec_StrDup( vStr );
+    pLib = Mio_LibraryRead( pName, Vec_StrArray(vStr), NULL, 0 );
+    if ( pLib != NULL )
+    {
+        *ppLib2 = Amap_LibReadAndPrepare( pName, Vec_StrArray(vStr2), 0, 0 );
+        if ( *ppLib2 == NULL )
+        {
+            Mio_LibraryDelete( pLib );
+            pLib = NULL;
+        }
+    }
+    Vec_StrFree( vStr );
+    Vec_StrFree( vStr2 );
+    return pLib;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the current network.]
+
+  Description [The CIs are numbered first (PIs followed by the latch
+  outputs), followed by the internal nodes in a topological order.
+  Number 0 is reserved for the constant node of the AIG. The fanins are
+  saved as literals (allowing for complemented edges) of the difference
+  between the object number and the fanin number, as in AIGER.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Io_SesWriteTime( Vec_Str_t * vOut, Abc_Time_t * pTime )
+{
+    Vec_StrPutF( vOut, pTime->Rise );
+    Vec_StrPutF( vOut, pTime->Fall );
+}
+void Io_SesWriteTiming( Vec_Str_t * vOut, Abc_Ntk_t * pNtk )
+{
+    Abc_Time_t * pArrs = Abc_NtkGetCiArrivalTimes( pNtk );
+    Abc_Time_t * pReqs = Abc_NtkGetCoRequiredTimes( pNtk );
+    Vec_Int_t * vNums = Vec_IntStartFull( Abc_NtkObjNumMax(pNtk) );
+    Abc_Obj_t * pObj;
+    int i, fInDrive, fOutLoad;
+    fInDrive = Abc_NtkCiNum(pNtk) > 0 && Abc_NodeReadInputDrive(pNtk, 0) != NULL;
+    fOutLoad = Abc_NtkCoNum(pNtk) > 0 && Abc_NodeReadOutputLoad(pNtk, 0) != NULL;
+    Io_SesWriteTime( vOut, Abc_NtkReadDefaultArrival(pNtk) );
+    Io_SesWriteTime( vOut, Abc_NtkReadDefaultRequired(pNtk) );
+    Io_SesWriteTime( vOut, Abc_NtkReadDefaultInputDrive(pNtk) );
+    Io_SesWriteTime( vOut, Abc_NtkReadDefaultOutputLoad(pNtk) );
+    // the arrays are ordered by the CI/CO numbers of the network
+    Abc_NtkForEachCi( pNtk, pObj, i )
+        Vec_IntWriteEntry( vNums, Abc_ObjId(pObj), i );
+    Abc_NtkForEachCo( pNtk, pObj, i )
+        Vec_IntWriteEntry( vNums, Abc_ObjId(pObj), i );
+    Abc_NtkForEachPi( pNtk, pObj, i )
+        Io_SesWriteTime( vOut, pArrs + Vec_IntEntry(vNums, Abc_ObjId(pObj)) );
+    Abc_NtkForEachLatch( pNtk, pObj, i )
+        Io_SesWriteTime( vOut, pArrs + Vec_IntEntry(vNums, Abc_ObjId(Abc_ObjFanout0(pObj))) );
+    Abc_NtkForEachPo( pNtk, pObj, i )
+        Io_SesWriteTime( vOut, pReqs + Vec_IntEntry(vNums, Abc_ObjId(pObj)) );
+    Abc_NtkForEachLatch( pNtk, pObj, i )
+        Io_SesWriteTime( vOut, pReqs + Vec_IntEntry(vNums, Abc_ObjId(Abc_ObjFanin0(pObj))) );
+    // the input drives and the output loads are only saved if they differ from the default
+    Vec_StrPutI( vOut, fInDrive );
+    if ( fInDrive )
+    {
+        Abc_NtkForEachPi( pNtk, pObj, i )
+            Io_SesWriteTime( vOut, Abc_NodeReadInputDrive(pNtk, Vec_IntEntry(vNums, Abc_ObjId(pObj))) );
+        Abc_NtkForEachLatch( pNtk, pObj, i )
+            Io_SesWriteTime( vOut, Abc_NodeReadInputDrive(pNtk, Vec_IntEntry(vNums, Abc_ObjId(Abc_ObjFanout0(pObj)))) );
+    }
+    Vec_StrPutI( vOut, fOutLoad );
+    if ( fOutLoad )
+    {
+        Abc_NtkForEachPo( pNtk, pObj, i )
+            Io_SesWriteTime( vOut, Abc_NodeReadOutputLoad(pNtk, Vec_IntEntry(vNums, Abc_ObjId(pObj))) );
+        Abc_NtkForEachLatch( pNtk, pObj, i )
+            Io_SesWriteTime( vOut, Abc_NodeReadOutputLoad(pNtk, Vec_IntEntry(vNums, Abc_ObjId(Abc_ObjFanin0(pObj)))) );
+    }
+    Vec_IntFree( vNums );
+    ABC_FREE( pArrs );
+    ABC_FREE( pReqs );
+}
+static inline void Io_SesWriteFanin( Vec_Str_t * vOut, Vec_Int_t * vMap, int iObj, Abc_Obj_t * pObj, int i )
+{
+    int iFanin = Vec_IntEntry( vMap, Abc_ObjFaninId(pObj, i) );
+    assert( iFanin >= 0 && iFanin < iObj );
+    Vec_StrPutI( vOut, Abc_Var2Lit(iObj - iFanin, i < 2 && Abc_ObjFaninC(pObj, i)) );
+}
+int Io_SesWriteNtk( Vec_Str_t * vOut, Abc_Ntk_t * pNtk )
+{
+    Vec_Int_t * vMap;
+    Vec_Ptr_t * vNodes;
+    Abc_Obj_t * pObj, * pFanin;
+    Mio_Gate_t * pGate;
+    int i, k, iObj, nObjs = 1;
+    assert( Abc_NtkIsStrash(pNtk) || Abc_NtkHasSop(pNtk) || Abc_NtkHasMapping(pNtk) );
+    vNodes = Abc_NtkIsStrash(pNtk) ? Abc_AigDfs( pNtk, 1, 0 ) : Abc_NtkDfs( pNtk, 1 );
+    // number the objects
+    vMap = Vec_IntStartFull( Abc_NtkObjNumMax(pNtk) );
+    if ( Abc_NtkIsStrash(pNtk) )
+        Vec_IntWriteEntry( vMap, Abc_ObjId(Abc_AigConst1(pNtk)), 0 );
+    Abc_NtkForEachPi( pNtk, pObj, i )
+        Vec_IntWriteEntry( vMap, Abc_ObjId(pObj), nObjs++ );
+    Abc_NtkForEachLatch( pNtk, pObj, i )
+        Vec_IntWriteEntry( vMap, Abc_ObjId(Abc_ObjFanout0(pObj)), nObjs++ );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+        Vec_IntWriteEntry( vMap, Abc_ObjId(pObj), nObjs++ );
+    // write the header
+    Vec_StrPutS( vOut, pNtk->pName ? pNtk->pName : (char *)"" );
+    Vec_StrPutS( vOut, pNtk->pSpec ? pNtk->pSpec : (char *)"" );
+    Vec_StrPutI( vOut, (int)pNtk->ntkType );
+    Vec_StrPutI( vOut, (int)pNtk->ntkFunc );
+    Vec_StrPutI( vOut, Abc_NtkPiNum(pNtk) );
+    Vec_StrPutI( vOut, Abc_NtkPoNum(pNtk) );
+    Vec_StrPutI( vOut, Abc_NtkLatchNum(pNtk) );
+    Vec_StrPutI( vOut, Vec_PtrSize(vNodes) );
+    Vec_StrPutF( vOut, pNtk->AndGateDelay );
+    // write the names and the initial states
+    Abc_NtkForEachPi( pNtk, pObj, i )
+        Vec_StrPutS( vOut, Abc_ObjName(pObj) );
+    Abc_NtkForEachPo( pNtk, pObj, i )
+        Vec_StrPutS( vOut, Abc_ObjName(pObj) );
+    Abc_NtkForEachLatch( pNtk, pObj, i )
+    {
+        Vec_StrPutI( vOut, Abc_LatchInit(pObj) );
+        Vec_StrPutS( vOut, Abc_ObjName(pObj) );
+        Vec_StrPutS( vOut, Abc_ObjName(Abc_ObjFanin0(pObj)) );
+        Vec_StrPutS( vOut, Abc_ObjName(Abc_ObjFanout0(pObj)) );
+    }
+    // write the internal nodes
+    Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
+    {
+        iObj = Vec_IntEntry( vMap, Abc_ObjId(pObj) );
+        if ( Abc_NtkIsStrash(pNtk) )
+        {
+            Io_SesWriteFanin( vOut, vMap, iObj, pObj, 0 );
+            Io_SesWriteFanin( vOut, vMap, iObj, pObj, 1 );
+            continue;
+        }
+        Vec_StrPutI( vOut, Abc_ObjFaninNum(pObj) );
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Io_SesWriteFanin( vOut, vMap, iObj, pObj, k );
+        if ( Abc_NtkHasSop(pNtk) )
+        {
+            Vec_StrPutS( vOut, (char *)pObj->pData );
+            continue;
+        }
+        pGate = (Mio_Gate_t *)pObj->pData;
+        Vec_StrPutS( vOut, Mio_GateReadName(pGate) );
+        Vec_StrPutS( vOut, Mio_GateReadOutName(pGate) );
+    }
+    // write the drivers of the COs
+    Abc_NtkForEachPo( pNtk, pObj, i )
+        Io_SesWriteFanin( vOut, vMap, nObjs, pObj, 0 );
+    Abc_NtkForEachLatch( pNtk, pObj, i )
+        Io_SesWriteFanin( vOut, vMap, nObjs, Abc_ObjFanin0(pObj), 0 );
+    // write the timing information
+    Vec_StrPutI( vOut, pNtk->pManTime != NULL );
+    if ( pNtk->pManTime )
+        Io_SesWriteTiming( vOut, pNtk );
+    Vec_PtrFree( vNodes );
+    Vec_IntFree( vMap );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the current network.]
+
+  Description [Returns NULL if the network cannot be restored, which
+  happens if the data is corrupted or if the network is mapped into the
+  gates that are missing in the genlib library. The mapped network is
+  restored using the given library, which may differ from the current
+  one if the session file contains its own library.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Io_SesReadTime( Vec_Str_t * vIn, int * pPos, Abc_Time_t * pTime )
+{
+    pTime->Rise = Io_SesGetF( vIn, pPos );
+    pTime->Fall = Io_SesGetF( vIn, pPos );
+}
+void Io_SesReadTiming( Vec_Str_t * vIn, int * pPos, Abc_Ntk_t * pNtk )
+{
+    Abc_Time_t Time;
+    Abc_Obj_t * pObj;
+    int i;
+    Io_SesReadTime( vIn, pPos, &Time );
+    Abc_NtkTimeSetDefaultArrival( pNtk, Time.Rise, Time.Fall );
+    Io_SesReadTime( vIn, pPos, &Time );
+    Abc_NtkTimeSetDefaultRequired( pNtk, Time.Rise, Time.Fall );
+    Io_SesReadTime( vIn, pPos, &Time );
+    Abc_NtkTimeSetDefaultInputDrive( pNtk, Time.Rise, Time.Fall );
+    Io_SesReadTime( vIn, pPos, &Time );
+    Abc_NtkTimeSetDefaultOutputLoad( pNtk, Time.Rise, Time.Fall );
+    // the CIs/COs of the new network are ordered in the same way as in the file
+    Abc_NtkForEachCi( pNtk, pObj, i )
+    {
+        Io_SesReadTime( vIn, pPos, &Time );
+        Abc_NtkTimeSetArrival( pNtk, Abc_ObjId(pObj), Time.Rise, Time.Fall );
+    }
+    Abc_NtkForEachCo( pNtk, pObj, i )
+    {
+        Io_SesReadTime( vIn, pPos, &Time );
+        Abc_NtkTimeSetRequired( pNtk, Abc_ObjId(pObj), Time.Rise, Time.Fall );
+    }
+    if ( Io_SesGetI( vIn, pPos ) )
+        Abc_NtkForEachCi( pNtk, pObj, i )
+        {
+            Io_SesReadTime( vIn, pPos, &Time );
+            Abc_NtkTimeSetInputDrive( pNtk, i, Time.Rise, Time.Fall );
+        }
+    if ( Io_SesGetI( vIn, pPos ) )
+        Abc_NtkForEachCo( pNtk, pObj, i )
+        {
+            Io_SesReadTime( vIn, pPos, &Time );
+            Abc_NtkTimeSetOutputLoad( pNtk, i, Time.Rise, Time.Fall );
+        }
+}
+// returns NULL if the literal does not point to an earlier object
+static inline Abc_Obj_t * Io_SesReadFanin( Vec_Str_t * vIn, int * pPos, Vec_Ptr_t * vObjs, int fCompl )
+{
+    Abc_Obj_t * pObj;
+    int Lit = Io_SesGetI( vIn, pPos );
+    if ( Lit < 0 || Abc_Lit2Var(Lit) < 1 || Abc_Lit2Var(Lit) > Vec_PtrSize(vObjs) || (!fCompl && Abc_LitIsCompl(Lit)) )
+        return NULL;
+    pObj = (Abc_Obj_t *)Vec_PtrEntry( vObjs, Vec_PtrSize(vObjs) - Abc_Lit2Var(Lit) );
+    return pObj ? Abc_ObjNotCond( pObj, Abc_LitIsCompl(Lit) ) : NULL;
+}
+// checks that the SOP is composed of the cubes with the given number of literals
+static inline int Io_SesCheckSop( char * pSop, int nFanins )
+{
+    char * pCur = pSop;
+    int k;
+    if ( *pCur == 0 )
+        return 0;
+    while ( *pCur )
+    {
+        for ( k = 0; k < nFanins; k++, pCur++ )
+            if ( *pCur != '0' && *pCur != '1' && *pCur != '-' )
+                return 0;
+        if ( pCur[0] != ' ' || (pCur[1] != '0' && pCur[1] != '1' && pCur[1] != 'x' && pCur[1] != 'n') || pCur[2] != '\n' )
+            return 0;
+        pCur += 3;
+    }
+    return 1;
+}
+Abc_Ntk_t * Io_SesReadNtk( Vec_Str_t * vIn, Mio_Library_t * pLibGen )
+{
+    Abc_Ntk_t * pNtk;
+    Abc_Obj_t * pObj, * pTerm, * pFanin0, * pFanin1;
+    Vec_Ptr_t * vObjs;
+    Mio_Gate_t * pGate;
+    char * pName, * pSpec, * pGateName, * pSop, * pError = NULL;
+    Abc_NtkType_t Type;
+    Abc_NtkFunc_t Func;
+    int i, k, Init, nPis, nPos, nLatches, nNodes, nFanins, Pos = 0;
+    pName    = Io_SesGetS( vIn, &Pos );
+    pSpec    = Io_SesGetS( vIn, &Pos );
+    Type     = (Abc_NtkType_t)Io_SesGetI( vIn, &Pos );
+    Func     = (Abc_NtkFunc_t)Io_SesGetI( vIn, &Pos );
+    nPis     = Io_SesGetI( vIn, &Pos );
+    nPos     = Io_SesGetI( vIn, &Pos );
+    nLatches = Io_SesGetI( vIn, &Pos );
+    nNodes   = Io_SesGetI( vIn, &Pos );
+    if ( !Io_SesIsOk(vIn, Pos) )
+    {
+        printf( "Io_SesReadNtk(): The network data is truncated.\n" );
+        return NULL;
+    }
+    if ( !(Type == ABC_NTK_STRASH && Func == ABC_FUNC_AIG) && !(Type == ABC_NTK_LOGIC && (Func == ABC_FUNC_SOP || Func == ABC_FUNC_MAP)) )
+    {
+        printf( "Io_SesReadNtk(): Unsupported network type.\n" );
+        return NULL;
+    }
+    // each name takes at least one byte, each node at least two bytes
+    if ( nPis < 0 || nPos < 0 || nLatches < 0 || nNodes < 0 ||
+         (word)nPis + (word)nPos + 4 * (word)nLatches + 2 * (word)nNodes > (word)(Vec_StrSize(vIn) - Pos) )
+    {
+        printf( "Io_SesReadNtk(): The object counts do not match the size of the network data.\n" );
+        return NULL;
+    }
+    if ( Func == ABC_FUNC_MAP && pLibGen == NULL )
+    {
+        printf( "Io_SesReadNtk(): The network is mapped but the genlib library is not available.\n" );
+        return NULL;
+    }
+    pNtk = Abc_NtkAlloc( Type, Func, 1 );
+    if ( Func == ABC_FUNC_MAP )
+        pNtk->pManFunc = pLibGen;
+    pNtk->pName = pName[0] ? Abc_UtilStrsav( pName ) : NULL;
+    pNtk->pSpec = pSpec[0] ? Abc_UtilStrsav( pSpec ) : NULL;
+    pNtk->AndGateDelay = Io_SesGetF( vIn, &Pos );
+    vObjs = Vec_PtrAlloc( 1 + nPis + nLatches + nNodes );
+    Vec_PtrPush( vObjs, Abc_NtkIsStrash(pNtk) ? Abc_AigConst1(pNtk) : NULL );
+    // create the CIs and the COs
+    for ( i = 0; i < nPis; i++ )
+    {
+        pObj = Abc_NtkCreatePi( pNtk );
+        Abc_ObjAssignName( pObj, Io_SesGetS(vIn, &Pos), NULL );
+        Vec_PtrPush( vObjs, pObj );
+    }
+    for ( i = 0; i < nPos; i++ )
+        Abc_ObjAssignName( Abc_NtkCreatePo(pNtk), Io_SesGetS(vIn, &Pos), NULL );
+    for ( i = 0; i < nLatches; i++ )
+    {
+        Init = Io_SesGetI( vIn, &Pos );
+        if ( Init < ABC_INIT_NONE || Init > ABC_INIT_DC )
+        {
+            pError = "Incorrect initial state of a latch";
+            goto finish;
+        }
+        pObj = Abc_NtkCreateLatch( pNtk );
+        pObj->pData = (void *)(ABC_PTRINT_T)Init;
+        Abc_ObjAssignName( pObj, Io_SesGetS(vIn, &Pos), NULL );
+        pTerm = Abc_NtkCreateBi( pNtk );
+        Abc_ObjAssignName( pTerm, Io_SesGetS(vIn, &Pos), NULL );
+        Abc_ObjAddFanin( pObj, pTerm );
+        pTerm = Abc_NtkCreateBo( pNtk );
+        Abc_ObjAssignName( pTerm, Io_SesGetS(vIn, &Pos), NULL );
+        Abc_ObjAddFanin( pTerm, pObj );
+        Vec_PtrPush( vObjs, pTerm );
+    }
+    // create the internal nodes
+    for ( i = 0; i < nNodes; i++ )
+    {
+        if ( Abc_NtkIsStrash(pNtk) )
+        {
+            pFanin0 = Io_SesReadFanin( vIn, &Pos, vObjs, 1 );
+            pFanin1 = Io_SesReadFanin( vIn, &Pos, vObjs, 1 );
+            if ( pFanin0 == NULL || pFanin1 == NULL )
+            {
+                pError = "Incorrect fanin of an AND node";
+                goto finish;
+            }
+            Vec_PtrPush( vObjs, Abc_AigAnd((Abc_Aig_t *)pNtk->pManFunc, pFanin0, pFanin1) );
+            continue;
+        }
+        pObj = Abc_NtkCreateNode( pNtk );
+        nFanins = Io_SesGetI( vIn, &Pos );
+        if ( nFanins < 0 || nFanins > Vec_StrSize(vIn) - Pos )
+        {
+            pError = "Incorrect fanin count of a node";
+            goto finish;
+        }
+        for ( k = 0; k < nFanins; k++ )
+        {
+            pFanin0 = Io_SesReadFanin( vIn, &Pos, vObjs, 0 );
+            if ( pFanin0 == NULL )
+            {
+                pError = "Incorrect fanin of a node";
+                goto finish;
+            }
+            Abc_ObjAddFanin( pObj, pFanin0 );
+        }
+        if ( Abc_NtkHasSop(pNtk) )
+        {
+            pSop = Io_SesGetS( vIn, &Pos );
+            if ( !Io_SesCheckSop(pSop, nFanins) )
+            {
+                pError = "Incorrect SOP of a node";
+                goto finish;
+            }
+            pObj->pData = Abc_SopRegister( (Mem_Flex_t *)pNtk->pManFunc, pSop );
+        }
+        else
+        {
+            pGateName = Io_SesGetS( vIn, &Pos );
+            pGate = Mio_LibraryReadGateByName( pLibGen, pGateName, Io_SesGetS(vIn, &Pos) );
+            if ( pGate == NULL )
+            {
+                printf( "Io_SesReadNtk(): Cannot find gate \"%s\" in the genlib library.\n", pGateName );
+                pError = "The network cannot be restored";
+                goto finish;
+            }
+            if ( Mio_GateReadPinNum(pGate) != nFanins )
+            {
+                pError = "Incorrect fanin count of a gate";
+                goto finish;
+            }
+            pObj->pData = pGate;
+        }
+        Vec_PtrPush( vObjs, pObj );
+    }
+    // connect the COs
+    Abc_NtkForEachCo( pNtk, pObj, i )
+    {
+        pFanin0 = Io_SesReadFanin( vIn, &Pos, vObjs, Abc_NtkIsStrash(pNtk) );
+        if ( pFanin0 == NULL )
+        {
+            pError = "Incorrect driver of a combinational output";
+            goto finish;
+        }
+        Abc_ObjAddFanin( pObj, pFanin0 );
+    }
+    // read the timing information
+    if ( Io_SesGetI( vIn, &Pos ) )
+        Io_SesReadTiming( vIn, &Pos, pNtk );
+    if ( Pos != Vec_StrSize(vIn) )
+        pError = "The network data is truncated or has extra bytes";
+    else
+    {
+        // the check expects the mapped network to use the current library,
+        // which is replaced by the library from the file only after reading
+        void * pLibCur = Abc_FrameReadLibGen();
+        Abc_FrameSetLibGen( Abc_NtkHasMapping(pNtk) ? pLibGen : pLibCur );
+        if ( !Abc_NtkCheck( pNtk ) )
+            pError = "The network check has failed";
+        Abc_FrameSetLibGen( pLibCur );
+    }
+finish:
+    Vec_PtrFree( vObjs );
+    if ( pError == NULL )
+        return pNtk;
+    printf( "Io_SesReadNtk(): %s.\n", pError );
+    Abc_NtkDelete( pNtk );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Appends one section to the session file.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Io_SesAddSection( Vec_Str_t * vOut, char Tag, Vec_Str_t * vSect )
+{
+    Vec_StrPush( vOut, Tag );
+    Vec_StrPutI_ne( vOut, Vec_StrSize(vSect) );
+    Vec_StrPushBuffer( vOut, Vec_StrArray(vSect), Vec_StrSize(vSect) );
+    Vec_StrClear( vSect );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the state of the frame into the session file.]
+
+  Description [Saves the LUT library, the standard-cell library, the
+  genlib library, the current network with its mapping and timing, and
+  the current AIG of the &-space. The network with BDD or AIG local
+  functions is saved as a network with SOPs, while the netlist is saved
+  as a logic network. Returns 1 on success.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_WriteSession( Abc_Frame_t * pAbc, char * pFileName )
+{
+    Abc_Ntk_t * pNtk = pAbc->pNtkCur;
+    Gia_Man_t * pGia;
+    Vec_Str_t * vOut, * vSect;
+    FILE * pFile;
+    int RetValue;
+    if ( pNtk && (pNtk->nBarBufs > 0 || pNtk->nBarBufs2 > 0 || Abc_NtkBlackboxNum(pNtk) > 0 || Abc_NtkWhiteboxNum(pNtk) > 0) )
+    {
+        printf( "Io_WriteSession(): Saving networks with barrier buffers or boxes is not supported.\n" );
+        return 0;
+    }
+    if ( pNtk && Abc_NtkHasMapping(pNtk) && pNtk->pManFunc != Abc_FrameReadLibGen() )
+    {
+        printf( "Io_WriteSession(): The network is mapped into a library different from the current one.\n" );
+        return 0;
+    }
+    vOut  = Vec_StrAlloc( 1 << 16 );
+    vSect = Vec_StrAlloc( 1 << 16 );
+    Vec_StrPrintStr( vOut, IO_SESSION_MAGIC );
+    Vec_StrPush( vOut, '\0' );
+    Vec_StrPutI_ne( vOut, IO_SESSION_VERSION );
+    // save the libraries
+    if ( pAbc->pLibLut )
+    {
+        Io_SesWriteLibLut( vSect, (If_LibLut_t *)pAbc->pLibLut );
+        Io_SesAddSection( vOut, 'L', vSect );
+    }
+    if ( pAbc->pLibScl )
+    {
+        Vec_Str_t * vScl = Abc_SclWriteToStr( (SC_Lib *)pAbc->pLibScl );
+        Io_SesAddSection( vOut, 'S', vScl );
+        Vec_StrFree( vScl );
+    }
+    if ( pAbc->pLibGen && Io_SesWriteLibGen(vSect, (Mio_Library_t *)pAbc->pLibGen) )
+        Io_SesAddSection( vOut, 'G', vSect );
+    // save the network
+    if ( pNtk )
+    {
+        if ( Abc_NtkIsNetlist(pNtk) )
+            pNtk = Abc_NtkToLogic( pNtk );
+        else if ( !Abc_NtkIsStrash(pNtk) && !Abc_NtkHasSop(pNtk) && !Abc_NtkHasMapping(pNtk) )
+        {
+            pNtk = Abc_NtkDup( pNtk );
+            Abc_NtkToSop( pNtk, -1, ABC_INFINITY );
+        }
+        Io_SesWriteNtk( vSect, pNtk );
+        Io_SesAddSection( vOut, 'N', vSect );
+        if ( pNtk != pAbc->pNtkCur )
+            Abc_NtkDelete( pNtk );
+    }
+    // save the AIG
+    if ( pAbc->pGia )
+    {
+        pGia = (pAbc->pGia->nXors || pAbc->pGia->nMuxes) ? Gia_ManDupNoMuxes( pAbc->pGia, 0 ) : pAbc->pGia;
+        Vec_StrFree( vSect );
+        vSect = Gia_AigerWriteIntoMemoryStrAll( pGia );
+        Io_SesAddSection( vOut, 'A', vSect );
+        if ( pGia != pAbc->pGia )
+            Gia_ManStop( pGia );
+    }
+    Io_SesAddSection( vOut, '.', vSect );
+    Vec_StrFree( vSect );
+    // write the file
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Io_WriteSession(): Cannot open the output file \"%s\".\n", pFileName );
+        Vec_StrFree( vOut );
+        return 0;
+    }
+    RetValue = (fwrite( Vec_StrArray(vOut), 1, (size_t)Vec_StrSize(vOut), pFile ) == (size_t)Vec_StrSize(vOut));
+    RetValue &= (fclose( pFile ) == 0);
+    if ( !RetValue )
+        printf( "Io_WriteSession(): Writing the output file \"%s\" has failed.\n", pFileName );
+    Vec_StrFree( vOut );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the session file into memory.]
+
+  Description [The mapping is private, which allows the readers to modify
+  the contents in place. If mapping is not available, reads the file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Io_SesMapFile( char * pFileName, int * pnFileSize, int * pfMapped )
+{
+    char * pContents;
+    FILE * pFile;
+    int nFileSize;
+#ifndef _WIN32
+    struct stat Stat;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd < 0 )
+        return NULL;
+    if ( fstat( fd, &Stat ) == 0 && Stat.st_size > 0 && Stat.st_size < 0x7FFFFFFF )
+    {
+        pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+        close( fd );
+        if ( pContents == (char *)MAP_FAILED )
+            return NULL;
+        *pnFileSize = (int)Stat.st_size;
+        *pfMapped = 1;
+        return pContents;
+    }
+    close( fd );
+#endif
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    nFileSize = Extra_FileSize( pFileName );
+    pContents = ABC_ALLOC( char, Abc_MaxInt(nFileSize, 1) );
+    nFileSize = (int)fread( pContents, 1, (size_t)nFileSize, pFile );
+    fclose( pFile );
+    *pnFileSize = nFileSize;
+    *pfMapped = 0;
+    return pContents;
+}
+void Io_SesUnmapFile( char * pContents, int nFileSize, int fMapped )
+{
+#ifndef _WIN32
+    if ( fMapped )
+    {
+        munmap( pContents, (size_t)nFileSize );
+        return;
+    }
+#endif
+    ABC_FREE( pContents );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the state of the frame from the session file.]
+
+  Description [The parts of the frame state that are not present in the
+  file are left unchanged. The frame is updated only if all sections have
+  been read successfully. Returns 1 on success.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_ReadSession( Abc_Frame_t * pAbc, char * pFileName )
+{
+    Vec_Str_t File, * vFile = &File;
+    Vec_Str_t Sect, * vSect = &Sect;
+    Abc_Ntk_t * pNtk = NULL;
+    Gia_Man_t * pGia = NULL;
+    If_LibLut_t * pLibLut = NULL;
+    SC_Lib * pLibScl = NULL;
+    Mio_Library_t * pLibGen = NULL;
+    Amap_Lib_t * pLibGen2 = NULL;
+    char * pContents, Tag;
+    int nFileSize, fMapped, Version, Pos, RetValue = 0;
+    pContents = Io_SesMapFile( pFileName, &nFileSize, &fMapped );
+    if ( pContents == NULL )
+    {
+        printf( "Io_ReadSession(): Cannot open the input file \"%s\".\n", pFileName );
+        return 0;
+    }
+    Pos = strlen(IO_SESSION_MAGIC) + 1;
+    if ( nFileSize < Pos + 4 || memcmp(pContents, IO_SESSION_MAGIC, (size_t)Pos) )
+    {
+        printf( "Io_ReadSession(): The file \"%s\" is not an ABC session file.\n", pFileName );
+        Io_SesUnmapFile( pContents, nFileSize, fMapped );
+        return 0;
+    }
+    vFile->nCap   = nFileSize;
+    vFile->nSize  = nFileSize;
+    vFile->pArray = pContents;
+    Version = Vec_StrGetI_ne( vFile, &Pos );
+    if ( Version < 1 || Version > IO_SESSION_VERSION )
+    {
+        printf( "Io_ReadSession(): The session file has version %d while the supported version is %d.\n", Version, IO_SESSION_VERSION );
+        Io_SesUnmapFile( pContents, nFileSize, fMapped );
+        return 0;
+    }
+    // decode all sections without changing the frame
+    while ( 1 )
+    {
+        if ( Pos + 5 > nFileSize )
+        {
+            printf( "Io_ReadSession(): The session file is truncated.\n" );
+            break;
+        }
+        // the section is decoded in place
+        Tag = Vec_StrGetC( vFile, &Pos );
+        vSect->nCap   = vSect->nSize = Vec_StrGetI_ne( vFile, &Pos );
+        vSect->pArray = pContents + Pos;
+        if ( vSect->nSize < 0 || vSect->nSize > nFileSize - Pos )
+        {
+            printf( "Io_ReadSession(): The session file is truncated.\n" );
+            break;
+        }
+        Pos += vSect->nSize;
+        if ( Tag == '.' )
+        {
+            RetValue = 1;
+            break;
+        }
+        if ( Tag == 'L' && pLibLut == NULL )
+        {
+            pLibLut = Io_SesReadLibLut( vSect );
+            if ( pLibLut == NULL )
+            {
+                printf( "Io_ReadSession(): Reading the LUT library has failed.\n" );
+                break;
+            }
+        }
+        else if ( Tag == 'S' && pLibScl == NULL )
+        {
+            pLibScl = Abc_SclReadFromStr( vSect );
+            if ( pLibScl == NULL )
+            {
+                printf( "Io_ReadSession(): Reading the standard-cell library has failed.\n" );
+                break;
+            }
+        }
+        else if ( Tag == 'G' && pLibGen == NULL )
+        {
+            pLibGen = Io_SesReadLibGen( vSect, &pLibGen2 );
+            if ( pLibGen == NULL )
+            {
+                printf( "Io_ReadSession(): Reading the genlib library has failed.\n" );
+                break;
+            }
+        }
+        else if ( Tag == 'N' && pNtk == NULL )
+        {
+            pNtk = Io_SesReadNtk( vSect, pLibGen ? pLibGen : (Mio_Library_t *)Abc_FrameReadLibGen() );
+            if ( pNtk == NULL )
+            {
+                printf( "Io_ReadSession(): Reading the network has failed.\n" );
+                break;
+            }
+        }
+        else if ( Tag == 'A' && pGia == NULL )
+        {
+            pGia = Gia_AigerReadFromMemory( Vec_StrArray(vSect), Vec_StrSize(vSect), 0, 1, 0 );
+            if ( pGia == NULL )
+            {
+                printf( "Io_ReadSession(): Reading the AIG has failed.\n" );
+                break;
+            }
+        }
+        else if ( Tag && strchr("LSGNA", Tag) )
+        {
+            printf( "Io_ReadSession(): The session file contains section '%c' more than once.\n", Tag );
+            break;
+        }
+    }
+    Io_SesUnmapFile( pContents, nFileSize, fMapped );
+    if ( !RetValue )
+    {
+        if ( pNtk )     Abc_NtkDelete( pNtk );
+        if ( pGia )     Gia_ManStop( pGia );
+        if ( pLibLut )  If_LibLutFree( pLibLut );
+        if ( pLibScl )  Abc_SclLibFree( pLibScl );
+        if ( pLibGen )  Mio_LibraryDelete( pLibGen );
+        if ( pLibGen2 ) Amap_LibFree( pLibGen2 );
+        return 0;
+    }
+    // install the new state
+    if ( pLibLut )
+    {
+        If_LibLutFree( (If_LibLut_t *)pAbc->pLibLut );
+        pAbc->pLibLut = pLibLut;
+    }
+    if ( pLibScl )
+    {
+        if ( pAbc->pLibScl )
+            Abc_SclLibFree( (SC_Lib *)pAbc->pLibScl );
+        pAbc->pLibScl = pLibScl;
+    }
+    if ( pLibGen )
+    {
+        Mio_UpdateGenlib( pLibGen );
+        Abc_FrameSetLibGen2( pLibGen2 );
+    }
+    if ( pNtk )
+    {
+        Abc_FrameReplaceCurrentNetwork( pAbc, pNtk );
+        Abc_FrameClearVerifStatus( pAbc );
+    }
+    if ( pGia )
+        Abc_FrameUpdateGia( pAbc, pGia );
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
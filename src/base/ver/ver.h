@@ -28,6 +28,7 @@
 
 #include <stdio.h>
 #include "base/abc/abc.h"
+#include "misc/util/utilNam.h"
 
 ////////////////////////////////////////////////////////////////////////
 ///                         PARAMETERS                               ///
@@ -58,7 +59,8 @@ struct Ver_Man_t_
     ProgressBar *   pProgress;
     // current design
     Abc_Des_t *     pDesign;
-    st__table *      tName2Suffix;
+    Abc_Nam_t *     pName2Suffix;  // the names of the buses
+    Vec_Int_t *     vName2Suffix;  // the range [m:n] of each bus
     // error handling
     FILE *          Output;
     int             fTopLevel;
@@ -563,11 +563,14 @@ int Ver_ParseModule( Ver_Man_t * pMan )
 int Ver_ParseLookupSuffix( Ver_Man_t * pMan, char * pWord, int * pnMsb, int * pnLsb )
 {
     unsigned Value;
+    int NameId;
     *pnMsb = *pnLsb = -1;
-    if ( pMan->tName2Suffix == NULL )
+    if ( pMan->pName2Suffix == NULL )
         return 1;
-    if ( ! st__lookup( pMan->tName2Suffix, (char *)pWord, (char **)&Value ) )
+    NameId = Abc_NamStrFind( pMan->pName2Suffix, pWord );
+    if ( NameId == 0 )
         return 1;
+    Value = (unsigned)Vec_IntEntry( pMan->vName2Suffix, NameId );
     *pnMsb = (Value >> 8) & 0xff;
     *pnLsb = Value & 0xff;
     return 1;
@@ -587,14 +590,21 @@ int Ver_ParseLookupSuffix( Ver_Man_t * pMan, char * pWord, int * pnMsb, int * pn
 int Ver_ParseInsertsSuffix( Ver_Man_t * pMan, char * pWord, int nMsb, int nLsb )
 {
     unsigned Value;
-    if ( pMan->tName2Suffix == NULL )
-        pMan->tName2Suffix = st__init_table( strcmp, st__strhash );
-    if ( st__is_member( pMan->tName2Suffix, pWord ) )
+    int NameId, fFound;
+    if ( pMan->pName2Suffix == NULL )
+    {
+        pMan->pName2Suffix = Abc_NamStart( 1000, 20 );
+        pMan->vName2Suffix = Vec_IntAlloc( 1000 );
+        Vec_IntPush( pMan->vName2Suffix, 0 );
+    }
+    NameId = Abc_NamStrFindOrAdd( pMan->pName2Suffix, pWord, &fFound );
+    if ( fFound )
         return 1;
     assert( nMsb >= 0 && nMsb < 128 );
     assert( nLsb >= 0 && nLsb < 128 );
     Value = (nMsb << 8) | nLsb;
-    st__insert( pMan->tName2Suffix, Extra_UtilStrsav(pWord), (char *)(ABC_PTRUINT_T)Value );
+    assert( NameId == Vec_IntSize(pMan->vName2Suffix) );
+    Vec_IntPush( pMan->vName2Suffix, (int)Value );
     return 1;
 }
 
@@ -611,14 +621,12 @@ int Ver_ParseInsertsSuffix( Ver_Man_t * pMan, char * pWord, int nMsb, int nLsb )
 ***********************************************************************/
 void Ver_ParseRemoveSuffixTable( Ver_Man_t * pMan )
 {
-    st__generator * gen;
-    char * pKey, * pValue;
-    if ( pMan->tName2Suffix == NULL )
+    if ( pMan->pName2Suffix == NULL )
         return;
-    st__foreach_item( pMan->tName2Suffix, gen, (const char **)&pKey, (char **)&pValue )
-        ABC_FREE( pKey );
-    st__free_table( pMan->tName2Suffix );
-    pMan->tName2Suffix = NULL;
+    Abc_NamStop( pMan->pName2Suffix );
+    Vec_IntFree( pMan->vName2Suffix );
+    pMan->pName2Suffix = NULL;
+    pMan->vName2Suffix = NULL;
 }
 
 /**Function*************************************************************
@@ -20,6 +20,13 @@
 
 #include "ver.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -30,6 +37,7 @@ ABC_NAMESPACE_IMPL_START
 #define VER_BUFFER_SIZE        1048576    // 1M  - size of the data chunk stored in memory
 #define VER_OFFSET_SIZE          65536    // 64K - load new data when less than this is left
 #define VER_WORD_SIZE            65536    // 64K - the largest token that can be returned
+#define VER_CHARSET_NUM              8    // the number of cached delimiter sets
 
 #define VER_MINIMUM(a,b)       (((a) < (b))? (a) : (b))
 
@@ -47,6 +55,11 @@ struct Ver_Stream_t_
     char *           pBufferCur;    // the current reading position
     char *           pBufferEnd;    // the first position not used by currently loaded data
     char *           pBufferStop;   // the position where loading new data will be done
+    iword            nMapSize;      // the size of the file mapping (0 if the file is read in chunks)
+    // delimiter sets
+    char *           pCharSets[VER_CHARSET_NUM];        // the recently used sets
+    char             pCharMasks[VER_CHARSET_NUM][256];  // the membership of chars in these sets
+    int              iCharSetNext;  // the set to be replaced next
     // tokens given to the user
     char             pChars[VER_WORD_SIZE+5]; // temporary storage for a word (plus end-of-string and two parentheses)
     int              nChars;        // the total number of characters in the word
@@ -55,11 +68,90 @@ struct Ver_Stream_t_
 };
 
 static void Ver_StreamReload( Ver_Stream_t * p );
+static int  Ver_StreamMap( Ver_Stream_t * p );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [The mapping is read-only, because the tokens are copied 
+  out of the buffer. Returns 0 if the file cannot be mapped; in this case, 
+  the file is read in chunks.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Ver_StreamMap( Ver_Stream_t * p )
+{
+#ifndef _WIN32
+    struct stat Stat;
+    char * pContents;
+    int fd = open( p->pFileName, O_RDONLY );
+    if ( fd < 0 )
+        return 0;
+    if ( fstat( fd, &Stat ) != 0 || Stat.st_size == 0 )
+    {
+        close( fd );
+        return 0;
+    }
+    pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return 0;
+#ifdef MADV_SEQUENTIAL
+    madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+#endif
+    p->nMapSize    = (iword)Stat.st_size;
+    p->nFileSize   = p->nMapSize;
+    p->nFileRead   = p->nMapSize;
+    p->nBufferSize = p->nMapSize;
+    p->pBuffer     = pContents;
+    p->pBufferCur  = p->pBuffer;
+    p->pBufferEnd  = p->pBuffer + p->nMapSize;
+    p->pBufferStop = p->pBufferEnd;
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the membership table of the delimiter set.]
+
+  Description [The tables of several recently used sets are cached, so 
+  that scanning a char takes one lookup instead of comparing it with each 
+  delimiter.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline char * Ver_StreamCharMask( Ver_Stream_t * p, char * pChars )
+{
+    char * pMask;
+    int i;
+    for ( i = 0; i < VER_CHARSET_NUM; i++ )
+        if ( p->pCharSets[i] && !strcmp(p->pCharSets[i], pChars) )
+            return p->pCharMasks[i];
+    i = p->iCharSetNext;
+    p->iCharSetNext = (p->iCharSetNext + 1) % VER_CHARSET_NUM;
+    ABC_FREE( p->pCharSets[i] );
+    p->pCharSets[i] = Abc_UtilStrsav( pChars );
+    pMask = p->pCharMasks[i];
+    memset( pMask, 0, 256 );
+    for ( ; *pChars; pChars++ )
+        pMask[(unsigned char)*pChars] = 1;
+    return pMask;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Starts the file reader for the given file.]
@@ -88,6 +180,13 @@ Ver_Stream_t * Ver_StreamAlloc( char * pFileName )
     p = ABC_ALLOC( Ver_Stream_t, 1 );
     memset( p, 0, sizeof(Ver_Stream_t) );
     p->pFileName   = pFileName;
+    p->nLineCounter = 1; // 1-based line counting
+    // map the whole file, which then looks as if it was completely loaded
+    if ( Ver_StreamMap( p ) )
+    {
+        fclose( pFile );
+        return p;
+    }
     p->pFile       = pFile;
     // get the file size, in bytes
     fseek( pFile, 0, SEEK_END );  
@@ -105,8 +204,6 @@ Ver_Stream_t * Ver_StreamAlloc( char * pFileName )
     // set the ponters to the end and the stopping point
     p->pBufferEnd  = p->pBuffer + nCharsToRead;
     p->pBufferStop = (p->nFileRead == p->nFileSize)? p->pBufferEnd : p->pBuffer + VER_BUFFER_SIZE - VER_OFFSET_SIZE;
-    // start the arrays
-    p->nLineCounter = 1; // 1-based line counting
     return p;
 }
 
@@ -156,9 +253,17 @@ void Ver_StreamReload( Ver_Stream_t * p )
 ***********************************************************************/
 void Ver_StreamFree( Ver_Stream_t * p )
 {
+    int i;
     if ( p->pFile )
         fclose( p->pFile );
+#ifndef _WIN32
+    if ( p->nMapSize )
+        munmap( p->pBuffer, (size_t)p->nMapSize );
+    else
+#endif
     ABC_FREE( p->pBuffer );
+    for ( i = 0; i < VER_CHARSET_NUM; i++ )
+        ABC_FREE( p->pCharSets[i] );
     ABC_FREE( p );
 }
 
@@ -303,9 +408,10 @@ char Ver_StreamPopChar( Ver_Stream_t * p )
 ***********************************************************************/
 void Ver_StreamSkipChars( Ver_Stream_t * p, char * pCharsToSkip )
 {
-    char * pChar, * pTemp;
+    char * pChar, * pMask;
     assert( !p->fStop );
     assert( pCharsToSkip != NULL );
+    pMask = Ver_StreamCharMask( p, pCharsToSkip );
     // check if the new data should to be loaded
     if ( p->pBufferCur > p->pBufferStop )
         Ver_StreamReload( p );
@@ -313,10 +419,7 @@ void Ver_StreamSkipChars( Ver_Stream_t * p, char * pCharsToSkip )
     for ( pChar = p->pBufferCur; pChar < p->pBufferEnd; pChar++ )
     {
         // skip symbols as long as they are in the list
-        for ( pTemp = pCharsToSkip; *pTemp; pTemp++ )
-            if ( *pChar == *pTemp )
-                break;
-        if ( *pTemp == 0 ) // pChar is not found in the list
+        if ( !pMask[(unsigned char)*pChar] ) // pChar is not found in the list
         {
             p->pBufferCur = pChar;
             return;
@@ -348,9 +451,10 @@ void Ver_StreamSkipChars( Ver_Stream_t * p, char * pCharsToSkip )
 ***********************************************************************/
 void Ver_StreamSkipToChars( Ver_Stream_t * p, char * pCharsToStop )
 {
-    char * pChar, * pTemp;
+    char * pChar, * pMask;
     assert( !p->fStop );
     assert( pCharsToStop != NULL );
+    pMask = Ver_StreamCharMask( p, pCharsToStop );
     // check if the new data should to be loaded
     if ( p->pBufferCur > p->pBufferStop )
         Ver_StreamReload( p );
@@ -358,10 +462,7 @@ void Ver_StreamSkipToChars( Ver_Stream_t * p, char * pCharsToStop )
     for ( pChar = p->pBufferCur; pChar < p->pBufferEnd; pChar++ )
     {
         // skip symbols as long as they are NOT in the list
-        for ( pTemp = pCharsToStop; *pTemp; pTemp++ )
-            if ( *pChar == *pTemp )
-                break;
-        if ( *pTemp == 0 ) // pChar is not found in the list
+        if ( !pMask[(unsigned char)*pChar] ) // pChar is not found in the list
         {
             // count the lines
             if ( *pChar == '\n' )
@@ -396,10 +497,11 @@ void Ver_StreamSkipToChars( Ver_Stream_t * p, char * pCharsToStop )
 ***********************************************************************/
 char * Ver_StreamGetWord( Ver_Stream_t * p, char * pCharsToStop )
 {
-    char * pChar, * pTemp;
+    char * pChar, * pMask;
     if ( p->fStop )
         return NULL;
     assert( pCharsToStop != NULL );
+    pMask = Ver_StreamCharMask( p, pCharsToStop );
     // check if the new data should to be loaded
     if ( p->pBufferCur > p->pBufferStop )
         Ver_StreamReload( p );
@@ -408,10 +510,7 @@ char * Ver_StreamGetWord( Ver_Stream_t * p, char * pCharsToStop )
     for ( pChar = p->pBufferCur; pChar < p->pBufferEnd; pChar++ )
     {
         // skip symbols as long as they are NOT in the list
-        for ( pTemp = pCharsToStop; *pTemp; pTemp++ )
-            if ( *pChar == *pTemp )
-                break;
-        if ( *pTemp == 0 ) // pChar is not found in the list
+        if ( !pMask[(unsigned char)*pChar] ) // pChar is not found in the list
         {
             p->pChars[p->nChars++] = *pChar;
             if ( p->nChars == VER_WORD_SIZE )
@@ -735,10 +735,12 @@ static inline void Scl_LibHandleInputDriver2( SC_Cell * pCell, SC_PairI * pLoadI
 
 /*=== sclLiberty.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose );
+extern SC_Lib *      Abc_SclReadLibertyCache( char * pFileName, int fUseCache, int fVerbose, int fVeryVerbose );
 /*=== sclLibScl.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadFromGenlib( void * pLib );
 extern SC_Lib *      Abc_SclReadFromStr( Vec_Str_t * vOut );
 extern SC_Lib *      Abc_SclReadFromFile( char * pFileName );
+extern Vec_Str_t *   Abc_SclWriteToStr( SC_Lib * p );
 extern void          Abc_SclWriteScl( char * pFileName, SC_Lib * p );
 extern void          Abc_SclWriteLiberty( char * pFileName, SC_Lib * p );
 /*=== sclLibUtil.c ===============================================================*/
@@ -610,6 +610,12 @@ static void Abc_SclWriteLibrary( Vec_Str_t * vOut, SC_Lib * p )
         }
     }
 }
+Vec_Str_t * Abc_SclWriteToStr( SC_Lib * p )
+{
+    Vec_Str_t * vOut = Vec_StrAlloc( 10000 );
+    Abc_SclWriteLibrary( vOut, p );
+    return vOut;
+}
 void Abc_SclWriteScl( char * pFileName, SC_Lib * p )
 {
     Vec_Str_t * vOut;
@@ -22,6 +22,14 @@
 #include "misc/st/st.h"
 #include "map/mio/mio.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -31,6 +39,10 @@ ABC_NAMESPACE_IMPL_START
 
 // #define ABC_MAX_LIB_STR_LEN 5000
 
+// the fixed part of the header of the cached binary library
+#define SCL_CACHE_MAGIC   "abc-scl-cache"
+#define SCL_CACHE_HEADER  (14 + 4 + 8 + 8 + 8 + 8 + 8)
+
 // entry types
 typedef enum { 
     SCL_LIBERTY_NONE = 0,        // 0:  unknown
@@ -1673,30 +1685,321 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     }
     return vOut;
 }
-SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose )
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the hash of the buffer.]
+
+  Description [The hash is used to key the cache entries by the contents
+  of the Liberty file, to detect the damaged entries, and to derive the 
+  name of the entry from the name of the Liberty file. The buffer is 
+  hashed one word at a time.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Scl_LibertyHashBuffer( char * pBuffer, word nSize )
+{
+    word Hash = ABC_CONST(0xCBF29CE484222325) ^ nSize, Word;
+    word i;
+    for ( i = 0; i < nSize; i += 8 )
+    {
+        Word = 0;
+        memcpy( &Word, pBuffer + i, (size_t)Abc_MinWord(8, nSize - i) );
+        Hash = (Hash ^ Word) * ABC_CONST(0x100000001B3);
+        Hash ^= Hash >> 29;
+    }
+    return Hash;
+}
+
+#ifndef _WIN32
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the hash of the contents of the Liberty file.]
+
+  Description [Returns 0 if the file cannot be read.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Scl_LibertyHashFile( char * pFileName, struct stat * pSrc )
+{
+    char * pContents;
+    word Hash;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd < 0 )
+        return 0;
+    if ( pSrc->st_size == 0 )
+    {
+        close( fd );
+        return Scl_LibertyHashBuffer( NULL, 0 );
+    }
+    pContents = (char *)mmap( NULL, (size_t)pSrc->st_size, PROT_READ, MAP_SHARED, fd, 0 );
+    close( fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return 0;
+    Hash = Scl_LibertyHashBuffer( pContents, (word)pSrc->st_size );
+    munmap( pContents, (size_t)pSrc->st_size );
+    return Hash ? Hash : 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the cache directory.]
+
+  Description [The cache directory is given by the environment variable
+  ABC_SCL_CACHE_DIR. Otherwise, it is the private directory of the user
+  in the temporary directory. The directory is created if it does not
+  exist. Returns NULL (after printing the reason) if the directory cannot
+  be created, or if it is not owned by the user, or if other users can
+  write into it.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Scl_LibertyCacheDir()
+{
+    static char Buffer[1000];
+    struct stat Stat;
+    char * pDir = getenv( "ABC_SCL_CACHE_DIR" );
+    if ( pDir == NULL )
+    {
+        pDir = getenv( "TMPDIR" );
+        snprintf( Buffer, sizeof(Buffer), "%s/abc-scl-cache-%d", pDir ? pDir : "/tmp", (int)getuid() );
+    }
+    else
+        snprintf( Buffer, sizeof(Buffer), "%s", pDir );
+    if ( mkdir( Buffer, 0700 ) != 0 && errno != EEXIST )
+    {
+        printf( "Cannot create the cache directory \"%s\" (%s). The library cache is not used.\n", Buffer, strerror(errno) );
+        return NULL;
+    }
+    if ( lstat( Buffer, &Stat ) != 0 || !S_ISDIR(Stat.st_mode) || Stat.st_uid != getuid() || (Stat.st_mode & 022) )
+    {
+        printf( "The cache directory \"%s\" should be owned and writable only by the current user. The library cache is not used.\n", Buffer );
+        return NULL;
+    }
+    return Buffer;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the library from the binary cache.]
+
+  Description [The cache entry is mapped read-only and shared, so that the
+  concurrent processes loading the same library share the pages, and the
+  library is decoded directly from the mapping. The entry starts with the
+  header, followed by the absolute name of the Liberty file and the library
+  in the SCL format. The entry is used only if the name, the size, the
+  modification time, and the hash of the contents of the Liberty file, as
+  well as the size and the hash of the SCL data, match those in the header.
+  Returns NULL otherwise.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+SC_Lib * Scl_LibertyCacheRead( char * pCacheName, char * pPath, struct stat * pSrc, word SrcHash )
+{
+    SC_Lib * pLib = NULL;
+    Vec_Str_t Str, * vStr = &Str;
+    struct stat Stat;
+    char * pContents, * pEnd;
+    word nDataSize, DataHash;
+    int Pos = strlen(SCL_CACHE_MAGIC) + 1;
+    int fd = open( pCacheName, O_RDONLY | O_NOFOLLOW );
+    if ( fd < 0 )
+        return NULL;
+    if ( fstat( fd, &Stat ) != 0 || !S_ISREG(Stat.st_mode) || Stat.st_uid != getuid() || 
+         Stat.st_size <= SCL_CACHE_HEADER || Stat.st_size >= 0x7FFFFFFF )
+    {
+        close( fd );
+        return NULL;
+    }
+    pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+    close( fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return NULL;
+    vStr->nCap   = vStr->nSize = (int)Stat.st_size;
+    vStr->pArray = pContents;
+    // check the header and the name of the Liberty file
+    if ( memcmp( pContents, SCL_CACHE_MAGIC, (size_t)Pos ) || 
+         Vec_StrGetI_ne( vStr, &Pos ) != ABC_SCL_CUR_VERSION || 
+         Vec_StrGetW( vStr, &Pos ) != (word)pSrc->st_size || 
+         Vec_StrGetW( vStr, &Pos ) != (word)pSrc->st_mtime || 
+         Vec_StrGetW( vStr, &Pos ) != SrcHash )
+        goto finish;
+    nDataSize = Vec_StrGetW( vStr, &Pos );
+    DataHash  = Vec_StrGetW( vStr, &Pos );
+    assert( Pos == SCL_CACHE_HEADER );
+    pEnd = (char *)memchr( pContents + Pos, 0, (size_t)(vStr->nSize - Pos) );
+    if ( pEnd == NULL || strcmp( pContents + Pos, pPath ) )
+        goto finish;
+    Pos = (int)(pEnd - pContents) + 1;
+    if ( nDataSize != (word)(vStr->nSize - Pos) || DataHash != Scl_LibertyHashBuffer(pContents + Pos, vStr->nSize - Pos) )
+        goto finish;
+    // the remaining part is the library in the SCL format
+    vStr->pArray += Pos;
+    vStr->nCap = vStr->nSize = vStr->nSize - Pos;
+    pLib = Abc_SclReadFromStr( vStr );
+    vStr->nSize += Pos;
+finish:
+    munmap( pContents, (size_t)vStr->nSize );
+    return pLib;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the library into the binary cache.]
+
+  Description [The entry is written into a new temporary file and renamed,
+  so that the concurrent processes never see an incomplete entry. Since
+  the entry name is derived from the name of the Liberty file, the new 
+  entry replaces the outdated entry of the same file.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Scl_LibertyCacheWrite( char * pCacheName, char * pPath, struct stat * pSrc, word SrcHash, Vec_Str_t * vLib )
+{
+    Vec_Str_t * vHead = Vec_StrAlloc( SCL_CACHE_HEADER + 1000 );
+    char * pTempName = ABC_ALLOC( char, strlen(pCacheName) + 20 );
+    FILE * pFile;
+    int fd, RetValue;
+    sprintf( pTempName, "%s.XXXXXX", pCacheName );
+    Vec_StrPrintStr( vHead, SCL_CACHE_MAGIC );
+    Vec_StrPush( vHead, '\0' );
+    Vec_StrPutI_ne( vHead, ABC_SCL_CUR_VERSION );
+    Vec_StrPutW( vHead, (word)pSrc->st_size );
+    Vec_StrPutW( vHead, (word)pSrc->st_mtime );
+    Vec_StrPutW( vHead, SrcHash );
+    Vec_StrPutW( vHead, (word)Vec_StrSize(vLib) );
+    Vec_StrPutW( vHead, Scl_LibertyHashBuffer(Vec_StrArray(vLib), Vec_StrSize(vLib)) );
+    assert( Vec_StrSize(vHead) == SCL_CACHE_HEADER );
+    Vec_StrPrintStr( vHead, pPath );
+    Vec_StrPush( vHead, '\0' );
+    // the temporary file is created with the permissions 0600
+    fd = mkstemp( pTempName );
+    pFile = fd >= 0 ? fdopen( fd, "wb" ) : NULL;
+    if ( pFile != NULL )
+    {
+        RetValue  = (fwrite( Vec_StrArray(vHead), 1, (size_t)Vec_StrSize(vHead), pFile ) == (size_t)Vec_StrSize(vHead));
+        RetValue &= (fwrite( Vec_StrArray(vLib), 1, (size_t)Vec_StrSize(vLib), pFile ) == (size_t)Vec_StrSize(vLib));
+        RetValue &= (fclose( pFile ) == 0);
+        if ( !RetValue || rename( pTempName, pCacheName ) != 0 )
+            remove( pTempName );
+    }
+    else if ( fd >= 0 )
+    {
+        close( fd );
+        remove( pTempName );
+    }
+    Vec_StrFree( vHead );
+    ABC_FREE( pTempName );
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the Liberty library.]
+
+  Description [If fUseCache is set, the library is first looked up in the 
+  binary cache. If the library is not cached, it is parsed and added to 
+  the cache. The cache is not read if the skipped gates are to be printed
+  (fVeryVerbose), because this information is only produced by the parser.
+  The cache is not available on Windows.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+SC_Lib * Abc_SclReadLibertyCache( char * pFileName, int fUseCache, int fVerbose, int fVeryVerbose )
 {
     SC_Lib * pLib;
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
+    char * pCacheName = NULL, * pPath = NULL;
+    abctime clk = Abc_Clock();
+#ifndef _WIN32
+    struct stat Src;
+    word SrcHash = 0;
+    char * pDir;
+#endif
+    Scl_LibertyFixFileName( pFileName );
+#ifndef _WIN32
+    if ( fUseCache && (pDir = Scl_LibertyCacheDir()) && (pPath = realpath(pFileName, NULL)) && stat(pPath, &Src) == 0 && (SrcHash = Scl_LibertyHashFile(pPath, &Src)) )
+    {
+        pCacheName = ABC_ALLOC( char, strlen(pDir) + 30 );
+        sprintf( pCacheName, "%s/abc_scl_%016llx.scl", pDir, (unsigned long long)Scl_LibertyHashBuffer(pPath, strlen(pPath)) );
+        pLib = fVeryVerbose ? NULL : Scl_LibertyCacheRead( pCacheName, pPath, &Src, SrcHash );
+        if ( pLib != NULL )
+        {
+            if ( fVerbose )
+            {
+                printf( "Library \"%s\" from \"%s\" has %d cells (read from cache \"%s\").  ", 
+                    pLib->pName, pFileName, SC_LibCellNum(pLib), pCacheName );
+                Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+            }
+            ABC_FREE( pCacheName );
+            free( pPath );
+            pLib->pFileName = Abc_UtilStrsav( pFileName );
+            Abc_SclLibNormalize( pLib );
+            return pLib;
+        }
+    }
+#else
+    if ( fUseCache )
+        printf( "The library cache is not available on this platform.\n" );
+#endif
     p = Scl_LibertyParse( pFileName, fVeryVerbose );
     if ( p == NULL )
+    {
+        ABC_FREE( pCacheName );
+        if ( pPath ) free( pPath );
         return NULL;
+    }
 //    Scl_LibertyParseDump( p, "temp_.lib" );
     // collect relevant data
     vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose );
     Scl_LibertyStop( p, fVeryVerbose );
     if ( vStr == NULL )
+    {
+        ABC_FREE( pCacheName );
+        if ( pPath ) free( pPath );
         return NULL;
+    }
+#ifndef _WIN32
+    if ( pCacheName )
+        Scl_LibertyCacheWrite( pCacheName, pPath, &Src, SrcHash, vStr );
+#endif
+    ABC_FREE( pCacheName );
+    if ( pPath ) free( pPath );
     // construct SCL data-structure
     pLib = Abc_SclReadFromStr( vStr );
+    Vec_StrFree( vStr );
     if ( pLib == NULL )
         return NULL;
     pLib->pFileName = Abc_UtilStrsav( pFileName );
     Abc_SclLibNormalize( pLib );
-    Vec_StrFree( vStr );
 //    printf( "Average slew = %.2f ps\n", Abc_SclComputeAverageSlew(pLib) );
     return pLib;
 }
+SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose )
+{
+    return Abc_SclReadLibertyCache( pFileName, 0, fVerbose, fVeryVerbose );
+}
 
 /**Function*************************************************************
 
@@ -72,9 +72,11 @@ typedef struct Nm_Man_t_ Nm_Man_t;
 
 /*=== nmApi.c ==========================================================*/
 extern Nm_Man_t *   Nm_ManCreate( int nSize );
+extern void         Nm_ManSharePool( Nm_Man_t * p, Nm_Man_t * pFrom );
 extern void         Nm_ManFree( Nm_Man_t * p );
 extern int          Nm_ManNumEntries( Nm_Man_t * p );
 extern char *       Nm_ManStoreIdName( Nm_Man_t * p, int ObjId, int Type, char * pName, char * pSuffix );
+extern char *       Nm_ManCopyIdName( Nm_Man_t * p, int ObjId, int Type, Nm_Man_t * pFrom, int ObjIdFrom );
 extern void         Nm_ManDeleteIdName( Nm_Man_t * p, int ObjId );
 extern char *       Nm_ManCreateUniqueName( Nm_Man_t * p, int ObjId );
 extern char *       Nm_ManFindNameById( Nm_Man_t * p, int ObjId );
@@ -45,23 +45,35 @@ ABC_NAMESPACE_IMPL_START
 Nm_Man_t * Nm_ManCreate( int nSize )
 {
     Nm_Man_t * p;
-    // allocate the table
-    p = ABC_ALLOC( Nm_Man_t, 1 );
-    memset( p, 0, sizeof(Nm_Man_t) );
-    // set the parameters
-    p->nSizeFactor   = 2; // determined the limit on the grow of data before the table resizes
-    p->nGrowthFactor = 3; // determined how much the table grows after resizing
-    // allocate and clean the bins
-    p->nBins = Abc_PrimeCudd(nSize);
-    p->pBinsI2N = ABC_ALLOC( Nm_Entry_t *, p->nBins );
-    p->pBinsN2I = ABC_ALLOC( Nm_Entry_t *, p->nBins );
-    memset( p->pBinsI2N, 0, sizeof(Nm_Entry_t *) * p->nBins );
-    memset( p->pBinsN2I, 0, sizeof(Nm_Entry_t *) * p->nBins );
-    // start the memory manager
-    p->pMem = Extra_MmFlexStart();
+    p = ABC_CALLOC( Nm_Man_t, 1 );
+    p->pStrs = Abc_NamStart( nSize, 10 );
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Makes the empty name manager share the names of another one.]
+
+  Description [After this, the names are transferred between the two
+  managers by reference and without hashing (see Nm_ManCopyIdName).
+  The string storage is reference-counted and is freed when the last
+  manager using it is freed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nm_ManSharePool( Nm_Man_t * p, Nm_Man_t * pFrom )
+{
+    assert( p->nEntries == 0 );
+    if ( p->pStrs == pFrom->pStrs )
+        return;
+    Abc_NamDeref( p->pStrs );
+    p->pStrs = Abc_NamRef( pFrom->pStrs );
+    Vec_IntClear( &p->vName2Obj );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Deallocates the name manager.]
@@ -75,9 +87,12 @@ Nm_Man_t * Nm_ManCreate( int nSize )
 ***********************************************************************/
 void Nm_ManFree( Nm_Man_t * p )
 {
-    Extra_MmFlexStop( p->pMem );
-    ABC_FREE( p->pBinsI2N );
-    ABC_FREE( p->pBinsN2I );
+    Abc_NamDeref( p->pStrs );
+    Vec_IntErase( &p->vObj2Name );
+    Vec_StrErase( &p->vObj2Type );
+    Vec_IntErase( &p->vObj2Next );
+    Vec_IntErase( &p->vName2Obj );
+    Vec_StrErase( &p->vBuffer );
     ABC_FREE( p );
 }
 
@@ -111,27 +126,55 @@ int Nm_ManNumEntries( Nm_Man_t * p )
 ***********************************************************************/
 char * Nm_ManStoreIdName( Nm_Man_t * p, int ObjId, int Type, char * pName, char * pSuffix )
 {
-    Nm_Entry_t * pEntry;
-    int RetValue, nEntrySize;
+    int NameId;
     // check if the object with this ID is already stored
-    if ( (pEntry = Nm_ManTableLookupId(p, ObjId)) )
+    if ( Nm_ManObjNameId(p, ObjId) )
+    {
+        printf( "Nm_ManStoreIdName(): Entry with the same ID already exists.\n" );
+        return NULL;
+    }
+    if ( pSuffix )
+    {
+        Vec_StrClear( &p->vBuffer );
+        Vec_StrAppend( &p->vBuffer, pName );
+        Vec_StrAppend( &p->vBuffer, pSuffix );
+        Vec_StrPush( &p->vBuffer, '\0' );
+        pName = Vec_StrArray( &p->vBuffer );
+    }
+    // add the entry to the tables
+    NameId = Abc_NamStrFindOrAdd( p->pStrs, pName, NULL );
+    Nm_ManTableAdd( p, ObjId, Type, NameId );
+    return Abc_NamStr( p->pStrs, NameId );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Copies the name of the object from another manager.]
+
+  Description [If the managers share the storage, the name is transferred 
+  without hashing. If this manager is empty and does not use its storage,
+  it starts sharing the storage of the other manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Nm_ManCopyIdName( Nm_Man_t * p, int ObjId, int Type, Nm_Man_t * pFrom, int ObjIdFrom )
+{
+    int NameId = Nm_ManObjNameId( pFrom, ObjIdFrom );
+    assert( NameId > 0 );
+    if ( p->pStrs != pFrom->pStrs && p->nEntries == 0 && Abc_NamObjNumMax(p->pStrs) == 1 )
+        Nm_ManSharePool( p, pFrom );
+    if ( p->pStrs != pFrom->pStrs )
+        return Nm_ManStoreIdName( p, ObjId, Type, Abc_NamStr(pFrom->pStrs, NameId), NULL );
+    if ( Nm_ManObjNameId(p, ObjId) )
     {
         printf( "Nm_ManStoreIdName(): Entry with the same ID already exists.\n" );
         return NULL;
     }
-    // create a new entry
-    nEntrySize = sizeof(Nm_Entry_t) + strlen(pName) + (pSuffix?strlen(pSuffix):0) + 1;
-//    nEntrySize = (nEntrySize / 4 + ((nEntrySize % 4) > 0)) * 4;
-    nEntrySize = (nEntrySize / sizeof(char*) + ((nEntrySize % sizeof(char*)) > 0)) * sizeof(char*); // added by Saurabh on Sep 3, 2009
-    pEntry = (Nm_Entry_t *)Extra_MmFlexEntryFetch( p->pMem, nEntrySize );
-    pEntry->pNextI2N = pEntry->pNextN2I = pEntry->pNameSake = NULL;
-    pEntry->ObjId = ObjId;
-    pEntry->Type = Type;
-    sprintf( pEntry->Name, "%s%s", pName, pSuffix? pSuffix : "" );
-    // add the entry to the hash table
-    RetValue = Nm_ManTableAdd( p, pEntry );
-    assert( RetValue == 1 );
-    return pEntry->Name;
+    Nm_ManTableAdd( p, ObjId, Type, NameId );
+    return Abc_NamStr( p->pStrs, NameId );
 }
 
 /**Function*************************************************************
@@ -148,9 +191,7 @@ char * Nm_ManStoreIdName( Nm_Man_t * p, int ObjId, int Type, char * pName, char
 ***********************************************************************/
 void Nm_ManDeleteIdName( Nm_Man_t * p, int ObjId )
 {
-    Nm_Entry_t * pEntry;
-    pEntry = Nm_ManTableLookupId(p, ObjId);
-    if ( pEntry == NULL )
+    if ( Nm_ManObjNameId(p, ObjId) == 0 )
     {
         printf( "Nm_ManDeleteIdName(): This entry is not in the table.\n" );
         return;
@@ -175,12 +216,11 @@ void Nm_ManDeleteIdName( Nm_Man_t * p, int ObjId )
 char * Nm_ManCreateUniqueName( Nm_Man_t * p, int ObjId )
 {
     static char NameStr[1000];
-    Nm_Entry_t * pEntry;
-    int i;
-    if ( (pEntry = Nm_ManTableLookupId(p, ObjId)) )
-        return pEntry->Name;
+    int i, NameId;
+    if ( (NameId = Nm_ManObjNameId(p, ObjId)) )
+        return Abc_NamStr( p->pStrs, NameId );
     sprintf( NameStr, "n%d", ObjId );
-    for ( i = 1; Nm_ManTableLookupName(p, NameStr, -1); i++ )
+    for ( i = 1; Nm_ManTableLookupName(p, NameStr, -1) >= 0; i++ )
         sprintf( NameStr, "n%d_%d", ObjId, i );
     return NameStr;
 }
@@ -198,10 +238,7 @@ char * Nm_ManCreateUniqueName( Nm_Man_t * p, int ObjId )
 ***********************************************************************/
 char * Nm_ManFindNameById( Nm_Man_t * p, int ObjId )
 {
-    Nm_Entry_t * pEntry;
-    if ( (pEntry = Nm_ManTableLookupId(p, ObjId)) )
-        return pEntry->Name;
-    return NULL;
+    return Abc_NamStr( p->pStrs, Nm_ManObjNameId(p, ObjId) );
 }
 
 /**Function*************************************************************
@@ -218,10 +255,7 @@ char * Nm_ManFindNameById( Nm_Man_t * p, int ObjId )
 ***********************************************************************/
 int Nm_ManFindIdByName( Nm_Man_t * p, char * pName, int Type )
 {
-    Nm_Entry_t * pEntry;
-    if ( (pEntry = Nm_ManTableLookupName(p, pName, Type)) )
-        return pEntry->ObjId;
-    return -1;
+    return Nm_ManTableLookupName( p, pName, Type );
 }
 
 /**Function*************************************************************
@@ -261,11 +295,11 @@ int Nm_ManFindIdByNameTwoTypes( Nm_Man_t * p, char * pName, int Type1, int Type2
 Vec_Int_t * Nm_ManReturnNameIds( Nm_Man_t * p )
 {
     Vec_Int_t * vNameIds;
-    int i;
+    int i, NameId;
     vNameIds = Vec_IntAlloc( p->nEntries );
-    for ( i = 0; i < p->nBins; i++ )
-        if ( p->pBinsI2N[i] )
-            Vec_IntPush( vNameIds, p->pBinsI2N[i]->ObjId );
+    Vec_IntForEachEntry( &p->vObj2Name, NameId, i )
+        if ( NameId )
+            Vec_IntPush( vNameIds, i );
     return vNameIds;
 }
 
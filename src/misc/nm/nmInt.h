@@ -28,6 +28,7 @@
 
 #include "misc/extra/extra.h"
 #include "misc/vec/vec.h"
+#include "misc/util/utilNam.h"
 #include "nm.h"
 
 ////////////////////////////////////////////////////////////////////////
@@ -43,41 +44,31 @@ ABC_NAMESPACE_HEADER_START
 ///                         BASIC TYPES                              ///
 ////////////////////////////////////////////////////////////////////////
 
-typedef struct Nm_Entry_t_ Nm_Entry_t;
-struct Nm_Entry_t_
-{
-    unsigned         Type;          // object type
-    unsigned         ObjId;         // object ID
-    Nm_Entry_t *     pNextI2N;      // the next entry in the ID hash table
-    Nm_Entry_t *     pNextN2I;      // the next entry in the name hash table
-    Nm_Entry_t *     pNameSake;     // the next entry with the same name
-    char             Name[0];       // name of the object
-};
-
 struct Nm_Man_t_
 {
-    Nm_Entry_t **    pBinsI2N;      // mapping IDs into names
-    Nm_Entry_t **    pBinsN2I;      // mapping names into IDs 
-    int              nBins;         // the number of bins in tables
+    Abc_Nam_t *      pStrs;         // interned names (shared by managers of duplicated networks)
+    Vec_Int_t        vObj2Name;     // mapping object IDs into name IDs (0 if no name)
+    Vec_Str_t        vObj2Type;     // mapping object IDs into object types
+    Vec_Int_t        vObj2Next;     // the next object with the same name (object ID + 1)
+    Vec_Int_t        vName2Obj;     // the first object with the given name (object ID + 1)
     int              nEntries;      // the number of entries
-    int              nSizeFactor;   // determined how much larger the table should be
-    int              nGrowthFactor; // determined how much the table grows after resizing
-    Extra_MmFlex_t * pMem;          // memory manager for entries (and names)
+    Vec_Str_t        vBuffer;       // temporary storage for names with suffixes
 };
 
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
 
+static inline int Nm_ManObjNameId( Nm_Man_t * p, int ObjId )  { return ObjId < Vec_IntSize(&p->vObj2Name) ? Vec_IntEntry(&p->vObj2Name, ObjId) : 0; }
+
 ////////////////////////////////////////////////////////////////////////
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
 /*=== nmTable.c ==========================================================*/
-extern int              Nm_ManTableAdd( Nm_Man_t * p, Nm_Entry_t * pEntry );
-extern int              Nm_ManTableDelete( Nm_Man_t * p, int ObjId );
-extern Nm_Entry_t *     Nm_ManTableLookupId( Nm_Man_t * p, int ObjId );
-extern Nm_Entry_t *     Nm_ManTableLookupName( Nm_Man_t * p, char * pName, int Type );
+extern void             Nm_ManTableAdd( Nm_Man_t * p, int ObjId, int Type, int NameId );
+extern void             Nm_ManTableDelete( Nm_Man_t * p, int ObjId );
+extern int              Nm_ManTableLookupName( Nm_Man_t * p, char * pName, int Type );
 
 
 
@@ -346,6 +346,22 @@ static inline abctime Abc_Clock()
 #endif
 }
 
+// wall-clock time (unlike Abc_Clock(), which is the CPU time of the calling
+// thread on Linux), used to compare time stamps taken by different threads
+static inline abctime Abc_ClockWall()
+{
+#if (defined(LIN) || defined(LIN64)) && !APPLE_MACH && !defined(__MINGW32__)
+    struct timespec ts;
+    if ( clock_gettime(CLOCK_MONOTONIC, &ts) < 0 ) 
+        return (abctime)-1;
+    abctime res = ((abctime) ts.tv_sec) * CLOCKS_PER_SEC;
+    res += (((abctime) ts.tv_nsec) * CLOCKS_PER_SEC) / 1000000000;
+    return res;
+#else
+    return ((abctime) time(NULL)) * CLOCKS_PER_SEC;
+#endif
+}
+
 
 // misc printing procedures
 enum Abc_VerbLevel
@@ -37,13 +37,22 @@ ABC_NAMESPACE_IMPL_START
 
 // this package maps non-empty character strings into natural numbers and back
 
+// the strings are stored in pages, which are never reallocated, so the pointers 
+// returned by Abc_NamStr() remain valid while the manager is alive; a handle
+// is the page number followed by ABC_NAM_PAGE_BITS bits of the offset in the page
+#define ABC_NAM_PAGE_BITS  20
+#define ABC_NAM_PAGE_MASK  ((1 << ABC_NAM_PAGE_BITS) - 1)
+
 // name manager
 struct Abc_Nam_t_
 {
     // info storage for names
+    Vec_Ptr_t        vPages;       // storage pages for name objects
+    int              iPage;        // the current page
+    int              nPage;        // the size of the current page
+    int              iOffset;      // the first free byte in the current page
     int              nStore;       // the size of allocated storage
-    int              iHandle;      // the current free handle
-    char *           pStore;       // storage for name objects
+    int              nUsed;        // the size of used storage
     // internal number mappings
     Vec_Int_t        vInt2Handle;  // mapping integers into handles
     Vec_Int_t        vInt2Next;    // mapping integers into nexts
@@ -56,7 +65,7 @@ struct Abc_Nam_t_
     Vec_Str_t        vBuffer;      
 };
 
-static inline char * Abc_NamHandleToStr( Abc_Nam_t * p, int h )        { return (char *)(p->pStore + h);                         }
+static inline char * Abc_NamHandleToStr( Abc_Nam_t * p, int h )        { return (char *)Vec_PtrEntry(&p->vPages, h >> ABC_NAM_PAGE_BITS) + (h & ABC_NAM_PAGE_MASK); }
 static inline int    Abc_NamIntToHandle( Abc_Nam_t * p, int i )        { return Vec_IntEntry(&p->vInt2Handle, i);                }
 static inline char * Abc_NamIntToStr( Abc_Nam_t * p, int i )           { return Abc_NamHandleToStr(p, Abc_NamIntToHandle(p,i));  }
 static inline int    Abc_NamIntToNext( Abc_Nam_t * p, int i )          { return Vec_IntEntry(&p->vInt2Next, i);                  }
@@ -83,15 +92,17 @@ Abc_Nam_t * Abc_NamStart( int nObjs, int nAveSize )
     if ( nObjs == 0 )
         nObjs = 16;
     p = ABC_CALLOC( Abc_Nam_t, 1 );
-    p->nStore      = ((nObjs * (nAveSize + 1) + 16) / 4) * 4;
-    p->pStore      = ABC_ALLOC( char, p->nStore );
+    p->nPage       = Abc_MinInt( ((nObjs * (nAveSize + 1) + 16) / 4) * 4, 1 << ABC_NAM_PAGE_BITS );
+    p->nStore      = p->nPage;
+    Vec_PtrPush( &p->vPages, ABC_ALLOC( char, p->nPage ) );
     p->nBins       = Abc_PrimeCudd( nObjs );
     p->pBins       = ABC_CALLOC( int, p->nBins );
     // 0th object is unused
     Vec_IntGrow( &p->vInt2Handle, nObjs );  Vec_IntPush( &p->vInt2Handle, -1 );
     Vec_IntGrow( &p->vInt2Next,   nObjs );  Vec_IntPush( &p->vInt2Next,   -1 );
-    p->iHandle     = 4;
-    memset( p->pStore, 0, 4 );
+    p->iOffset     = 4;
+    p->nUsed       = 4;
+    memset( Vec_PtrEntry(&p->vPages, 0), 0, 4 );
 //Abc_Print( 1, "Starting nam with %d bins.\n", p->nBins );
     // start reference counting
     p->nRefs       = 1;
@@ -115,7 +126,8 @@ void Abc_NamStop( Abc_Nam_t * p )
     Vec_StrErase( &p->vBuffer );
     Vec_IntErase( &p->vInt2Handle );
     Vec_IntErase( &p->vInt2Next );
-    ABC_FREE( p->pStore );
+    Vec_PtrFreeData( &p->vPages );
+    Vec_PtrErase( &p->vPages );
     ABC_FREE( p->pBins );
     ABC_FREE( p );
 }
@@ -248,7 +260,7 @@ int Abc_NamMemUsed( Abc_Nam_t * p )
 {
     if ( p == NULL )
         return 0;
-    return sizeof(Abc_Nam_t) + p->iHandle + sizeof(int) * p->nBins + 
+    return sizeof(Abc_Nam_t) + p->nUsed + sizeof(int) * p->nBins + 
         sizeof(int) * (p->vInt2Handle.nSize + p->vInt2Next.nSize);
 }
 
@@ -271,6 +283,45 @@ int Abc_NamMemAlloc( Abc_Nam_t * p )
         sizeof(int) * (p->vInt2Handle.nCap + p->vInt2Next.nCap);
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Allocates storage for a string of the given size.]
+
+  Description [Returns the handle. The strings are never moved: when 
+  the current page is full, a new page is started. Very long strings
+  get a page of their own.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_NamStoreAlloc( Abc_Nam_t * p, int nBytes )
+{
+    int iHandle;
+    p->nUsed += nBytes;
+    if ( nBytes > (1 << ABC_NAM_PAGE_BITS) )
+    {
+        assert( Vec_PtrSize(&p->vPages) < (1 << (31 - ABC_NAM_PAGE_BITS)) );
+        p->nStore += nBytes;
+        Vec_PtrPush( &p->vPages, ABC_ALLOC( char, nBytes ) );
+        return (Vec_PtrSize(&p->vPages) - 1) << ABC_NAM_PAGE_BITS;
+    }
+    if ( p->iOffset + nBytes > p->nPage )
+    {
+        assert( Vec_PtrSize(&p->vPages) < (1 << (31 - ABC_NAM_PAGE_BITS)) );
+        p->nPage   = Abc_MinInt( 2 * p->nPage, 1 << ABC_NAM_PAGE_BITS );
+        p->nPage   = Abc_MaxInt( p->nPage, nBytes );
+        p->nStore += p->nPage;
+        p->iPage   = Vec_PtrSize(&p->vPages);
+        p->iOffset = 0;
+        Vec_PtrPush( &p->vPages, ABC_ALLOC( char, p->nPage ) );
+    }
+    iHandle = (p->iPage << ABC_NAM_PAGE_BITS) | p->iOffset;
+    p->iOffset += nBytes;
+    return iHandle;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes hash value of the C-string.]
@@ -367,7 +418,6 @@ static inline int * Abc_NamStrHashFind( Abc_Nam_t * p, const char * pStr, const
 {
     char * pThis;
     int * pPlace = (int *)(p->pBins + Abc_NamStrHash( pStr, pLim, p->nBins ));
-    assert( *pStr );
     for ( pThis = (*pPlace)? Abc_NamIntToStr(p, *pPlace) : NULL; 
           pThis;    pPlace = Abc_NamIntToNextP(p, *pPlace), 
           pThis = (*pPlace)? Abc_NamIntToStr(p, *pPlace) : NULL )
@@ -470,20 +520,12 @@ int Abc_NamStrFindOrAdd( Abc_Nam_t * p, char * pStr, int * pfFound )
     }
     if ( pfFound )
         *pfFound = 0;
-    iHandleNew = p->iHandle + strlen(pStr) + 1;
-    while ( p->nStore < iHandleNew )
-    {
-        p->nStore *= 3;
-        p->nStore /= 2;
-        p->pStore  = ABC_REALLOC( char, p->pStore, p->nStore );
-    }
-    assert( p->nStore >= iHandleNew );
     // create new handle
+    iHandleNew = Abc_NamStoreAlloc( p, strlen(pStr) + 1 );
     *piPlace = Vec_IntSize( &p->vInt2Handle );
-    strcpy( Abc_NamHandleToStr( p, p->iHandle ), pStr );
-    Vec_IntPush( &p->vInt2Handle, p->iHandle );
+    strcpy( Abc_NamHandleToStr( p, iHandleNew ), pStr );
+    Vec_IntPush( &p->vInt2Handle, iHandleNew );
     Vec_IntPush( &p->vInt2Next, 0 );
-    p->iHandle = iHandleNew;
     // extend the hash table
     if ( Vec_IntSize(&p->vInt2Handle) > 2 * p->nBins )
         Abc_NamStrHashResize( p );
@@ -504,22 +546,14 @@ int Abc_NamStrFindOrAddLim( Abc_Nam_t * p, char * pStr, char * pLim, int * pfFou
     }
     if ( pfFound )
         *pfFound = 0;
-    iHandleNew = p->iHandle + (pLim - pStr) + 1;
-    while ( p->nStore < iHandleNew )
-    {
-        p->nStore *= 3;
-        p->nStore /= 2;
-        p->pStore  = ABC_REALLOC( char, p->pStore, p->nStore );
-    }
-    assert( p->nStore >= iHandleNew );
     // create new handle
+    iHandleNew = Abc_NamStoreAlloc( p, (pLim - pStr) + 1 );
     *piPlace = Vec_IntSize( &p->vInt2Handle );
-    pStore = Abc_NamHandleToStr( p, p->iHandle );
+    pStore = Abc_NamHandleToStr( p, iHandleNew );
     strncpy( pStore, pStr, pLim - pStr );
     pStore[pLim - pStr] = 0;
-    Vec_IntPush( &p->vInt2Handle, p->iHandle );
+    Vec_IntPush( &p->vInt2Handle, iHandleNew );
     Vec_IntPush( &p->vInt2Next, 0 );
-    p->iHandle = iHandleNew;
     // extend the hash table
     if ( Vec_IntSize(&p->vInt2Handle) > 2 * p->nBins )
         Abc_NamStrHashResize( p );
@@ -53,6 +53,8 @@ struct Dar_RwrPar_t_
     int              fRecycle;       // enables cut recycling
     int              fVerbose;       // enables verbose output
     int              fVeryVerbose;   // enables very verbose output
+    int              nProcs;         // the number of threads for windowed rewriting
+    int              nWinSize;       // the number of nodes in one window
 };
 
 struct Dar_RefPar_t_  
@@ -92,6 +94,8 @@ extern void            Dar_BalancePrintStats( Aig_Man_t * p );
 extern void            Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars );
 extern int             Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars );
 extern Aig_MmFixed_t * Dar_ManComputeCuts( Aig_Man_t * pAig, int nCutsMax, int fSkipTtMin, int fVerbose );
+/*=== darWin.c ========================================================*/
+extern Aig_Man_t *     Dar_ManRewriteWindows( Aig_Man_t * pAig, Dar_RwrPar_t * pPars );
 /*=== darRefact.c ========================================================*/
 extern void            Dar_ManDefaultRefParams( Dar_RefPar_t * pPars );
 extern int             Dar_ManRefactor( Aig_Man_t * pAig, Dar_RefPar_t * pPars );
@@ -60,6 +60,8 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
     pPars->fRecycle     =  1;
     pPars->fVerbose     =  0;
     pPars->fVeryVerbose =  0;
+    pPars->nProcs       =  1;
+    pPars->nWinSize     =  5000;
 }
 
 #define MAX_VAL 10
@@ -75,7 +77,7 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
   SeeAlso     []
 
 ***********************************************************************/
-int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+int Dar_ManRewriteInt( Aig_Man_t * pAig, Dar_RwrPar_t * pPars, Dar_Lib_t * pLib )
 {
     extern Vec_Int_t * Saig_ManComputeSwitchProbs( Aig_Man_t * p, int nFrames, int nPref, int fProbOne );
     Dar_Man_t * p;
@@ -86,10 +88,12 @@ int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
     abctime clk = 0, clkStart;
     int Counter = 0;
     int nMffcSize;//, nMffcGains[MAX_VAL+1][MAX_VAL+1] = {{0}};
-    // prepare the library
-    Dar_LibPrepare( pPars->nSubgMax ); 
+    // prepare the library (the library of a worker thread is already prepared)
+    if ( pLib == NULL )
+        Dar_LibPrepare( pPars->nSubgMax ); 
     // create rewriting manager
     p = Dar_ManStart( pAig, pPars );
+    p->pLib = pLib ? pLib : Dar_LibReadGlobal();
     if ( pPars->fPower )
         pAig->vProbs = Saig_ManComputeSwitchProbs( pAig, 48, 16, 1 );
     // remove dangling nodes
@@ -245,6 +249,22 @@ p->timeOther = p->timeTotal - p->timeCuts - p->timeEval;
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+    return Dar_ManRewriteInt( pAig, pPars, NULL );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the total number of cuts.]
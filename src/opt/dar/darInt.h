@@ -50,6 +50,7 @@ ABC_NAMESPACE_HEADER_START
 
 typedef struct Dar_Man_t_            Dar_Man_t;
 typedef struct Dar_Cut_t_            Dar_Cut_t;
+typedef struct Dar_Lib_t_            Dar_Lib_t;
 
 // the AIG 4-cut
 struct Dar_Cut_t_  // 6 words
@@ -69,6 +70,7 @@ struct Dar_Man_t_
     // input data
     Dar_RwrPar_t *   pPars;          // rewriting parameters
     Aig_Man_t *      pAig;           // AIG manager 
+    Dar_Lib_t *      pLib;           // library of subgraphs used by this manager
     // various data members
     Aig_MmFixed_t *  pMemCuts;       // memory manager for cuts
     void *           pManCnf;        // CNF managers
@@ -130,6 +132,7 @@ static inline void         Dar_ObjSetCuts( Aig_Obj_t * pObj, Dar_Cut_t * pCuts )
 
 /*=== darBalance.c ========================================================*/
 /*=== darCore.c ===========================================================*/
+extern int             Dar_ManRewriteInt( Aig_Man_t * pAig, Dar_RwrPar_t * pPars, Dar_Lib_t * pLib );
 /*=== darCut.c ============================================================*/
 extern void            Dar_ManCutsRestart( Dar_Man_t * p, Aig_Obj_t * pRoot );
 extern void            Dar_ManCutsFree( Dar_Man_t * p );
@@ -145,6 +148,9 @@ extern Vec_Int_t *     Dar_LibReadPrios();
 extern void            Dar_LibStart();
 extern void            Dar_LibStop();
 extern void            Dar_LibReturnCanonicals( unsigned * pCanons );
+extern Dar_Lib_t *     Dar_LibReadGlobal();
+extern Dar_Lib_t *     Dar_LibDupPrepared();
+extern void            Dar_LibFreeDup( Dar_Lib_t * p );
 extern void            Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Required, int * pnMffcSize );
 extern Aig_Obj_t *     Dar_LibBuildBest( Dar_Man_t * p );
 /*=== darMan.c ============================================================*/
@@ -0,0 +1,347 @@
+/**CFile****************************************************************
+
+  FileName    [darWin.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware AIG rewriting.]
+
+  Synopsis    [Windowed rewriting with parallel evaluation.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - April 28, 2007.]
+
+  Revision    [$Id: darWin.c,v 1.00 2007/04/28 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "darInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define DAR_THR_MAX 100
+
+typedef struct Dar_Win_t_ Dar_Win_t;
+struct Dar_Win_t_
+{
+    Vec_Ptr_t *      vLeaves;    // window inputs in the original AIG
+    Vec_Ptr_t *      vNodes;     // window nodes in a topological order
+    Vec_Ptr_t *      vRoots;     // window outputs in the original AIG
+    Aig_Man_t *      pAig;       // the window derived for rewriting
+    int              nNodesOld;  // the number of nodes before rewriting
+    int              nNodesNew;  // the number of nodes after rewriting
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Partitions the AIG into windows.]
+
+  Description [Nodes are split into consecutive chunks of the DFS order.
+  The inputs of each window belong to the previous windows, which makes
+  it possible to commit the windows one at a time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Dar_ManDeriveWindows( Aig_Man_t * p, int nWinSize )
+{
+    Vec_Ptr_t * vWins, * vNodes;
+    Vec_Int_t * vWinIds;
+    Vec_Bit_t * vIsRoot;
+    Dar_Win_t * pWin;
+    Aig_Obj_t * pObj, * pFanin;
+    int i, k, w, nWins;
+    vNodes  = Aig_ManDfs( p, 1 );
+    nWins   = Abc_MaxInt( 1, (Vec_PtrSize(vNodes) + nWinSize - 1) / nWinSize );
+    vWins   = Vec_PtrAlloc( nWins );
+    vWinIds = Vec_IntStartFull( Aig_ManObjNumMax(p) );
+    vIsRoot = Vec_BitStart( Aig_ManObjNumMax(p) );
+    for ( w = 0; w < nWins; w++ )
+    {
+        pWin = ABC_CALLOC( Dar_Win_t, 1 );
+        pWin->vLeaves = Vec_PtrAlloc( 100 );
+        pWin->vNodes  = Vec_PtrAlloc( nWinSize );
+        pWin->vRoots  = Vec_PtrAlloc( 100 );
+        Vec_PtrPush( vWins, pWin );
+    }
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+    {
+        pWin = (Dar_Win_t *)Vec_PtrEntry( vWins, i / nWinSize );
+        Vec_PtrPush( pWin->vNodes, pObj );
+        Vec_IntWriteEntry( vWinIds, pObj->Id, i / nWinSize );
+    }
+    Vec_PtrFree( vNodes );
+    // collect the inputs and mark the nodes used outside of their windows
+    Vec_PtrForEachEntry( Dar_Win_t *, vWins, pWin, w )
+    {
+        Aig_ManIncrementTravId( p );
+        Vec_PtrForEachEntry( Aig_Obj_t *, pWin->vNodes, pObj, i )
+            for ( k = 0; k < 2; k++ )
+            {
+                pFanin = k ? Aig_ObjFanin1(pObj) : Aig_ObjFanin0(pObj);
+                if ( Vec_IntEntry(vWinIds, pFanin->Id) == w || Aig_ObjIsTravIdCurrent(p, pFanin) )
+                    continue;
+                Aig_ObjSetTravIdCurrent( p, pFanin );
+                Vec_PtrPush( pWin->vLeaves, pFanin );
+                if ( Aig_ObjIsNode(pFanin) )
+                    Vec_BitWriteEntry( vIsRoot, pFanin->Id, 1 );
+            }
+    }
+    Aig_ManForEachCo( p, pObj, i )
+        if ( Aig_ObjIsNode(Aig_ObjFanin0(pObj)) )
+            Vec_BitWriteEntry( vIsRoot, Aig_ObjFaninId0(pObj), 1 );
+    Vec_PtrForEachEntry( Dar_Win_t *, vWins, pWin, w )
+        Vec_PtrForEachEntry( Aig_Obj_t *, pWin->vNodes, pObj, i )
+            if ( Vec_BitEntry(vIsRoot, pObj->Id) )
+                Vec_PtrPush( pWin->vRoots, pObj );
+    Vec_IntFree( vWinIds );
+    Vec_BitFree( vIsRoot );
+    return vWins;
+}
+void Dar_ManWindowFree( Dar_Win_t * pWin )
+{
+    if ( pWin->pAig )
+        Aig_ManStop( pWin->pAig );
+    Vec_PtrFree( pWin->vLeaves );
+    Vec_PtrFree( pWin->vNodes );
+    Vec_PtrFree( pWin->vRoots );
+    ABC_FREE( pWin );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the AIG of the window.]
+
+  Description [The window is a read-only snapshot of the original AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManWindowDerive( Dar_Win_t * pWin )
+{
+    Aig_Man_t * pNew;
+    Aig_Obj_t * pObj;
+    int i;
+    pNew = Aig_ManStart( Vec_PtrSize(pWin->vNodes) );
+    Vec_PtrForEachEntry( Aig_Obj_t *, pWin->vLeaves, pObj, i )
+        pObj->pData = Aig_ObjCreateCi( pNew );
+    Vec_PtrForEachEntry( Aig_Obj_t *, pWin->vNodes, pObj, i )
+        pObj->pData = Aig_And( pNew, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+    Vec_PtrForEachEntry( Aig_Obj_t *, pWin->vRoots, pObj, i )
+        Aig_ObjCreateCo( pNew, (Aig_Obj_t *)pObj->pData );
+    Aig_ManCleanup( pNew );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rewrites one window.]
+
+  Description [Uses the library given by the caller.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_ManWindowRewrite( Dar_Win_t * pWin, Dar_RwrPar_t * pPars, Dar_Lib_t * pLib )
+{
+    Aig_Man_t * pTemp;
+    pWin->nNodesOld = Aig_ManNodeNum( pWin->pAig );
+    Dar_ManRewriteInt( pWin->pAig, pPars, pLib );
+    pWin->pAig = Aig_ManDupDfs( pTemp = pWin->pAig );
+    Aig_ManStop( pTemp );
+    pWin->nNodesNew = Aig_ManNodeNum( pWin->pAig );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Assembles the resulting AIG from the windows.]
+
+  Description [Windows are visited in the topological order. A window
+  is replaced by its rewritten version only if the latter is smaller.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManWindowsCommit( Aig_Man_t * p, Vec_Ptr_t * vWins, int fUseZeros, int * pnCommits )
+{
+    Aig_Man_t * pNew, * pTemp;
+    Dar_Win_t * pWin;
+    Aig_Obj_t * pObj;
+    int i, w;
+    *pnCommits = 0;
+    pNew = Aig_ManStart( Aig_ManObjNumMax(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Aig_ManConst1(p)->pData = Aig_ManConst1(pNew);
+    Aig_ManForEachCi( p, pObj, i )
+        pObj->pData = Aig_ObjCreateCi( pNew );
+    Vec_PtrForEachEntry( Dar_Win_t *, vWins, pWin, w )
+    {
+        if ( pWin->nNodesNew < pWin->nNodesOld || (fUseZeros && pWin->nNodesNew == pWin->nNodesOld) )
+        {
+            Aig_ManConst1(pWin->pAig)->pData = Aig_ManConst1(pNew);
+            Vec_PtrForEachEntry( Aig_Obj_t *, pWin->vLeaves, pObj, i )
+                Aig_ManCi(pWin->pAig, i)->pData = pObj->pData;
+            Aig_ManForEachNode( pWin->pAig, pObj, i )
+                pObj->pData = Aig_And( pNew, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+            Vec_PtrForEachEntry( Aig_Obj_t *, pWin->vRoots, pObj, i )
+                pObj->pData = Aig_ObjChild0Copy( Aig_ManCo(pWin->pAig, i) );
+            (*pnCommits)++;
+        }
+        else
+        {
+            Vec_PtrForEachEntry( Aig_Obj_t *, pWin->vNodes, pObj, i )
+                pObj->pData = Aig_And( pNew, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+        }
+    }
+    Aig_ManForEachCo( p, pObj, i )
+        Aig_ObjCreateCo( pNew, Aig_ObjChild0Copy(pObj) );
+    Aig_ManSetRegNum( pNew, Aig_ManRegNum(p) );
+    pNew = Aig_ManDupDfs( pTemp = pNew );
+    Aig_ManStop( pTemp );
+    return pNew;
+}
+
+#ifndef ABC_USE_PTHREADS
+
+void Dar_ManWindowsRewriteAll( Vec_Ptr_t * vWins, Dar_RwrPar_t * pPars, int nProcs )
+{
+    Dar_Win_t * pWin;
+    int w;
+    Vec_PtrForEachEntry( Dar_Win_t *, vWins, pWin, w )
+        Dar_ManWindowRewrite( pWin, pPars, NULL );
+}
+
+#else // pthreads are used
+
+typedef struct Dar_ThData_t_
+{
+    Vec_Ptr_t *      vWins;      // windows to rewrite
+    Dar_RwrPar_t *   pPars;      // rewriting parameters
+    Dar_Lib_t *      pLib;       // library copy of this thread
+    int *            pNext;      // the next window to rewrite
+} Dar_ThData_t;
+
+static pthread_mutex_t s_DarWinMutex = PTHREAD_MUTEX_INITIALIZER;
+
+void * Dar_ManWindowThread( void * pArg )
+{
+    Dar_ThData_t * pThData = (Dar_ThData_t *)pArg;
+    int w, status;
+    while ( 1 )
+    {
+        status = pthread_mutex_lock( &s_DarWinMutex );  assert( status == 0 );
+        w = (*pThData->pNext)++;
+        status = pthread_mutex_unlock( &s_DarWinMutex );  assert( status == 0 );
+        if ( w >= Vec_PtrSize(pThData->vWins) )
+            break;
+        Dar_ManWindowRewrite( (Dar_Win_t *)Vec_PtrEntry(pThData->vWins, w), pThData->pPars, pThData->pLib );
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+void Dar_ManWindowsRewriteAll( Vec_Ptr_t * vWins, Dar_RwrPar_t * pPars, int nProcs )
+{
+    pthread_t WorkerThread[DAR_THR_MAX];
+    Dar_ThData_t ThData[DAR_THR_MAX];
+    int i, status, iNext = 0;
+    nProcs = Abc_MinInt( nProcs, Abc_MinInt(DAR_THR_MAX, Vec_PtrSize(vWins)) );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].vWins = vWins;
+        ThData[i].pPars = pPars;
+        ThData[i].pLib  = Dar_LibDupPrepared();
+        ThData[i].pNext = &iNext;
+        status = pthread_create( WorkerThread + i, NULL, Dar_ManWindowThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        Dar_LibFreeDup( ThData[i].pLib );
+    }
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Performs windowed rewriting.]
+
+  Description [The AIG is partitioned into windows of pPars->nWinSize
+  nodes, which are rewritten concurrently by pPars->nProcs threads.
+  Since the windows do not overlap, the improvements are committed in
+  one batch without conflicts. Returns the new AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManRewriteWindows( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+    Dar_RwrPar_t Pars = *pPars;
+    Aig_Man_t * pNew;
+    Vec_Ptr_t * vWins;
+    Dar_Win_t * pWin;
+    abctime clk = Abc_Clock();
+    int w, nCommits, nNodes = Aig_ManNodeNum(pAig);
+    assert( pPars->nWinSize > 0 );
+    // the library is prepared once and shared by the threads
+    Dar_LibPrepare( pPars->nSubgMax );
+    vWins = Dar_ManDeriveWindows( pAig, pPars->nWinSize );
+    Vec_PtrForEachEntry( Dar_Win_t *, vWins, pWin, w )
+        pWin->pAig = Dar_ManWindowDerive( pWin );
+    Pars.fVerbose = Pars.fVeryVerbose = 0;
+    Dar_ManWindowsRewriteAll( vWins, &Pars, pPars->nProcs );
+    pNew = Dar_ManWindowsCommit( pAig, vWins, pPars->fUseZeros, &nCommits );
+    if ( pPars->fVerbose )
+    {
+        printf( "Windows = %d. (Size = %d.)  Threads = %d.  Committed = %d.  Nodes: %d -> %d.  ",
+            Vec_PtrSize(vWins), pPars->nWinSize, pPars->nProcs, nCommits, nNodes, Aig_ManNodeNum(pNew) );
+        ABC_PRT( "Time", Abc_Clock() - clk );
+    }
+    Vec_PtrForEachEntry( Dar_Win_t *, vWins, pWin, w )
+        Dar_ManWindowFree( pWin );
+    Vec_PtrFree( vWins );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
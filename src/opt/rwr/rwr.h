@@ -28,6 +28,7 @@
 
 #include "base/abc/abc.h"
 #include "opt/cut/cut.h"
+#include "aig/gia/gia.h"
 
 ////////////////////////////////////////////////////////////////////////
 ///                         PARAMETERS                               ///
@@ -132,6 +133,8 @@ extern void              Rwr_ManPreprocess( Rwr_Man_t * p );
 extern int               Rwr_NodeRewrite( Rwr_Man_t * p, Cut_Man_t * pManCut, Abc_Obj_t * pNode, int fUpdateLevel, int fUseZeros, int fPlaceEnable );
 extern void              Rwr_ScoresClean( Rwr_Man_t * p );
 extern void              Rwr_ScoresReport( Rwr_Man_t * p );
+/*=== rwrGia.c ========================================================*/
+extern Gia_Man_t *       Rwr_ManRewriteGia( Gia_Man_t * p, int fUpdateLevel, int fUseZeros, int fVerbose );
 /*=== rwrLib.c ========================================================*/
 extern void              Rwr_ManPrecompute( Rwr_Man_t * p );
 extern Rwr_Node_t *      Rwr_ManAddVar( Rwr_Man_t * p, unsigned uTruth, int fPrecompute );
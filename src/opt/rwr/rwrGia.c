@@ -0,0 +1,646 @@
+/**CFile****************************************************************
+
+  FileName    [rwrGia.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware AIG rewriting package.]
+
+  Synopsis    [Batch rewriting of GIA using precomputed NPN subgraphs.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: rwrGia.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "rwr.h"
+#include "bool/dec/dec.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define RWR_GIA_CUT_MAX 12   // the max number of cuts stored at a node
+
+typedef struct Rwr_GiaCut_t_ Rwr_GiaCut_t;
+struct Rwr_GiaCut_t_
+{
+    unsigned           Sign;             // cut signature
+    unsigned           uTruth  : 16;     // truth table of the cut
+    unsigned           nLeaves : 16;     // the number of leaves
+    int                pLeaves[4];       // leaves in the increasing order
+};
+
+typedef struct Rwr_GiaMan_t_ Rwr_GiaMan_t;
+struct Rwr_GiaMan_t_
+{
+    Gia_Man_t *        pGia;             // the AIG being rewritten
+    Rwr_Man_t *        pRwr;             // the library of subgraphs
+    // flat match index
+    Vec_Int_t *        vClassBeg;        // the first subgraph of each NPN class
+    Vec_Ptr_t *        vGraphs;          // subgraphs of all classes in one array
+    // cuts
+    Rwr_GiaCut_t *     pCuts;            // cuts of all objects
+    int *              pnCuts;           // the number of cuts of each object
+    // best candidates
+    Vec_Int_t *        vGain;            // the best gain of each node
+    Vec_Int_t *        vCut;             // the best cut of each node
+    Vec_Int_t *        vGraph;           // the best subgraph of each node
+    Vec_Int_t *        vNodes;           // temporary storage
+    int                fUpdateLevel;     // preserve levels
+    int                fUseZeros;        // use zero-cost replacements
+    // statistics
+    int                nCutsTried;
+    int                nCands;
+};
+
+static inline Rwr_GiaCut_t * Rwr_GiaObjCuts( Rwr_GiaMan_t * p, int iObj ) { return p->pCuts + iObj * RWR_GIA_CUT_MAX; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Builds the flat index of subgraphs by NPN class.]
+
+  Description [Subgraphs of the class are stored consecutively in vGraphs,
+  starting at vClassBeg[Class] and ending before vClassBeg[Class+1].]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Rwr_GiaIndexStart( Rwr_GiaMan_t * p )
+{
+    Vec_Ptr_t * vSubgraphs;
+    Rwr_Node_t * pNode;
+    int i, k;
+    p->vClassBeg = Vec_IntAlloc( Vec_VecSize(p->pRwr->vClasses) + 1 );
+    p->vGraphs   = Vec_PtrAlloc( 1000 );
+    Vec_VecForEachLevel( p->pRwr->vClasses, vSubgraphs, i )
+    {
+        Vec_IntPush( p->vClassBeg, Vec_PtrSize(p->vGraphs) );
+        Vec_PtrForEachEntry( Rwr_Node_t *, vSubgraphs, pNode, k )
+            Vec_PtrPush( p->vGraphs, pNode->pNext );
+    }
+    Vec_IntPush( p->vClassBeg, Vec_PtrSize(p->vGraphs) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Re-expresses the truth table using the larger set of leaves.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Rwr_GiaTruthStretch( unsigned uTruth, int * pLeaves, int nLeaves, int * pLeavesNew, int nLeavesNew )
+{
+    int pPos[4], i, k, m, Index;
+    unsigned uRes = 0;
+    for ( i = k = 0; i < nLeaves; i++ )
+    {
+        while ( pLeavesNew[k] != pLeaves[i] )
+            k++;
+        pPos[i] = k;
+    }
+    for ( m = 0; m < 16; m++ )
+    {
+        for ( Index = i = 0; i < nLeaves; i++ )
+            if ( (m >> pPos[i]) & 1 )
+                Index |= (1 << i);
+        if ( (uTruth >> Index) & 1 )
+            uRes |= (1 << m);
+    }
+    return uRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Merges two cuts.]
+
+  Description [Returns 0 if the resulting cut has more than four leaves.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Rwr_GiaCutMerge( Rwr_GiaCut_t * pC0, Rwr_GiaCut_t * pC1, Rwr_GiaCut_t * pCut )
+{
+    int i = 0, k = 0, c = 0;
+    if ( Gia_WordCountOnes(pC0->Sign | pC1->Sign) > 4 )
+        return 0;
+    while ( i < (int)pC0->nLeaves || k < (int)pC1->nLeaves )
+    {
+        if ( c == 4 )
+            return 0;
+        if ( k == (int)pC1->nLeaves || (i < (int)pC0->nLeaves && pC0->pLeaves[i] < pC1->pLeaves[k]) )
+            pCut->pLeaves[c++] = pC0->pLeaves[i++];
+        else if ( i == (int)pC0->nLeaves || pC0->pLeaves[i] > pC1->pLeaves[k] )
+            pCut->pLeaves[c++] = pC1->pLeaves[k++];
+        else
+            pCut->pLeaves[c++] = pC0->pLeaves[i++], k++;
+    }
+    pCut->nLeaves = c;
+    pCut->Sign    = pC0->Sign | pC1->Sign;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the cut is dominated by one of the node's cuts.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Rwr_GiaCutIsDominated( Rwr_GiaCut_t * pCuts, int nCuts, Rwr_GiaCut_t * pCut )
+{
+    int i, k, m;
+    for ( i = 0; i < nCuts; i++ )
+    {
+        if ( pCuts[i].nLeaves > pCut->nLeaves || (pCuts[i].Sign & pCut->Sign) != pCuts[i].Sign )
+            continue;
+        for ( k = 0; k < (int)pCuts[i].nLeaves; k++ )
+        {
+            for ( m = 0; m < (int)pCut->nLeaves; m++ )
+                if ( pCuts[i].pLeaves[k] == pCut->pLeaves[m] )
+                    break;
+            if ( m == (int)pCut->nLeaves )
+                break;
+        }
+        if ( k == (int)pCuts[i].nLeaves )
+            return 1;
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes 4-input cuts with truth tables for all objects.]
+
+  Description [Cuts of each object are stored in a fixed-size slot of one
+  flat array. The first cut of every object is the trivial cut.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Rwr_GiaComputeCuts( Rwr_GiaMan_t * p )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Gia_Obj_t * pObj;
+    Rwr_GiaCut_t * pCuts, * pCuts0, * pCuts1, * pCut;
+    unsigned uTruth0, uTruth1;
+    int i, k, n, nCuts;
+    p->pCuts  = ABC_CALLOC( Rwr_GiaCut_t, Gia_ManObjNum(pGia) * RWR_GIA_CUT_MAX );
+    p->pnCuts = ABC_CALLOC( int, Gia_ManObjNum(pGia) );
+    Gia_ManForEachObj( pGia, pObj, i )
+    {
+        if ( !Gia_ObjIsCi(pObj) && !Gia_ObjIsAnd(pObj) )
+            continue;
+        pCuts = Rwr_GiaObjCuts( p, i );
+        pCuts[0].Sign       = 1 << (i & 31);
+        pCuts[0].uTruth     = 0xAAAA;
+        pCuts[0].nLeaves    = 1;
+        pCuts[0].pLeaves[0] = i;
+        nCuts = 1;
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            pCuts0 = Rwr_GiaObjCuts( p, Gia_ObjFaninId0(pObj, i) );
+            pCuts1 = Rwr_GiaObjCuts( p, Gia_ObjFaninId1(pObj, i) );
+            for ( k = 0; k < p->pnCuts[Gia_ObjFaninId0(pObj, i)] && nCuts < RWR_GIA_CUT_MAX; k++ )
+            for ( n = 0; n < p->pnCuts[Gia_ObjFaninId1(pObj, i)] && nCuts < RWR_GIA_CUT_MAX; n++ )
+            {
+                pCut = pCuts + nCuts;
+                if ( !Rwr_GiaCutMerge( pCuts0 + k, pCuts1 + n, pCut ) )
+                    continue;
+                if ( Rwr_GiaCutIsDominated( pCuts, nCuts, pCut ) )
+                    continue;
+                uTruth0 = Rwr_GiaTruthStretch( pCuts0[k].uTruth, pCuts0[k].pLeaves, pCuts0[k].nLeaves, pCut->pLeaves, pCut->nLeaves );
+                uTruth1 = Rwr_GiaTruthStretch( pCuts1[n].uTruth, pCuts1[n].pLeaves, pCuts1[n].nLeaves, pCut->pLeaves, pCut->nLeaves );
+                uTruth0 = Gia_ObjFaninC0(pObj) ? ~uTruth0 : uTruth0;
+                uTruth1 = Gia_ObjFaninC1(pObj) ? ~uTruth1 : uTruth1;
+                pCut->uTruth = 0xFFFF & uTruth0 & uTruth1;
+                nCuts++;
+            }
+        }
+        p->pnCuts[i] = nCuts;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Dereferences/references the MFFC of the node.]
+
+  Description [Dereferencing labels the MFFC nodes with the current
+  traversal ID and optionally collects them.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Rwr_GiaNodeDeref_rec( Gia_Man_t * p, Gia_Obj_t * pNode, Vec_Int_t * vNodes )
+{
+    Gia_Obj_t * pFanin;
+    int Counter = 1;
+    Gia_ObjSetTravIdCurrent( p, pNode );
+    if ( vNodes )
+        Vec_IntPush( vNodes, Gia_ObjId(p, pNode) );
+    pFanin = Gia_ObjFanin0(pNode);
+    if ( Gia_ObjRefDec(p, pFanin) == 0 && Gia_ObjIsAnd(pFanin) )
+        Counter += Rwr_GiaNodeDeref_rec( p, pFanin, vNodes );
+    pFanin = Gia_ObjFanin1(pNode);
+    if ( Gia_ObjRefDec(p, pFanin) == 0 && Gia_ObjIsAnd(pFanin) )
+        Counter += Rwr_GiaNodeDeref_rec( p, pFanin, vNodes );
+    return Counter;
+}
+static void Rwr_GiaNodeRef_rec( Gia_Man_t * p, Gia_Obj_t * pNode )
+{
+    Gia_Obj_t * pFanin;
+    pFanin = Gia_ObjFanin0(pNode);
+    if ( Gia_ObjRefInc(p, pFanin) == 0 && Gia_ObjIsAnd(pFanin) )
+        Rwr_GiaNodeRef_rec( p, pFanin );
+    pFanin = Gia_ObjFanin1(pNode);
+    if ( Gia_ObjRefInc(p, pFanin) == 0 && Gia_ObjIsAnd(pFanin) )
+        Rwr_GiaNodeRef_rec( p, pFanin );
+}
+static int Rwr_GiaCutMffc( Gia_Man_t * p, Gia_Obj_t * pNode, Rwr_GiaCut_t * pCut, Vec_Int_t * vNodes )
+{
+    int i, nNodes;
+    for ( i = 0; i < (int)pCut->nLeaves; i++ )
+        Gia_ObjRefIncId( p, pCut->pLeaves[i] );
+    Gia_ManIncrementTravId( p );
+    nNodes = Rwr_GiaNodeDeref_rec( p, pNode, vNodes );
+    Rwr_GiaNodeRef_rec( p, pNode );
+    for ( i = 0; i < (int)pCut->nLeaves; i++ )
+        Gia_ObjRefDecId( p, pCut->pLeaves[i] );
+    return nNodes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the literals of subgraph leaves.]
+
+  Description [Leaves are permuted and complemented to match the
+  canonical form of the cut function.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Rwr_GiaCutLeafLits( Rwr_GiaMan_t * p, Rwr_GiaCut_t * pCut, int * pLits )
+{
+    char * pPerm = p->pRwr->pPerms4[ (int)p->pRwr->pPerms[pCut->uTruth] ];
+    unsigned uPhase = p->pRwr->pPhases[pCut->uTruth];
+    int i;
+    for ( i = 0; i < 4; i++ )
+        pLits[i] = Abc_Var2Lit( pCut->pLeaves[(int)pPerm[i]], (uPhase >> i) & 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Counts the number of nodes added by the subgraph.]
+
+  Description [Uses structural hashing of the original AIG to detect
+  nodes that already exist outside of the labeled MFFC. Returns -1 if
+  the number of added nodes exceeds NodeMax or the level of the root
+  exceeds LevelMax.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Rwr_GiaGraphCount( Gia_Man_t * p, Dec_Graph_t * pGraph, int * pLits, int NodeMax, int LevelMax )
+{
+    Dec_Node_t * pNode, * pNode0, * pNode1;
+    int i, iLit0, iLit1, iLit, Level, Counter = 0;
+    if ( Dec_GraphIsConst(pGraph) || Dec_GraphIsVar(pGraph) )
+        return 0;
+    Dec_GraphForEachLeaf( pGraph, pNode, i )
+    {
+        pNode->iFunc = pLits[i];
+        pNode->Level = Gia_ObjLevelId( p, Abc_Lit2Var(pLits[i]) );
+    }
+    Dec_GraphForEachNode( pGraph, pNode, i )
+    {
+        pNode0 = Dec_GraphNode( pGraph, pNode->eEdge0.Node );
+        pNode1 = Dec_GraphNode( pGraph, pNode->eEdge1.Node );
+        iLit   = -1;
+        if ( pNode0->iFunc >= 0 && pNode1->iFunc >= 0 )
+        {
+            iLit0 = Abc_LitNotCond( pNode0->iFunc, pNode->eEdge0.fCompl );
+            iLit1 = Abc_LitNotCond( pNode1->iFunc, pNode->eEdge1.fCompl );
+            if ( iLit0 < 2 || iLit1 < 2 )
+                iLit = (iLit0 == 0 || iLit1 == 0) ? 0 : Abc_MaxInt(iLit0, iLit1);
+            else if ( iLit0 == iLit1 )
+                iLit = iLit0;
+            else if ( iLit0 == Abc_LitNot(iLit1) )
+                iLit = 0;
+            else
+            {
+                iLit = Gia_ManHashLookupInt( p, iLit0, iLit1 );
+                if ( iLit == 0 || Gia_ObjIsTravIdCurrentId(p, Abc_Lit2Var(iLit)) )
+                    iLit = -1;
+            }
+        }
+        if ( iLit == -1 && ++Counter > NodeMax )
+            return -1;
+        if ( iLit >= 0 )
+            Level = Gia_ObjLevelId( p, Abc_Lit2Var(iLit) );
+        else
+            Level = 1 + Abc_MaxInt( pNode0->Level, pNode1->Level );
+        if ( Level > LevelMax )
+            return -1;
+        pNode->iFunc = iLit;
+        pNode->Level = Level;
+    }
+    return Counter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the best replacement for each node.]
+
+  Description [The AIG is not modified. The gain of each node is the
+  size of its cut-bounded MFFC minus the number of nodes added.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Rwr_GiaEvaluate( Rwr_GiaMan_t * p )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Gia_Obj_t * pObj;
+    Rwr_GiaCut_t * pCut;
+    int pLits[4];
+    int i, c, g, k, Class, nSaved, nAdded, Counter, LevelMax;
+    p->vGain  = Vec_IntStartFull( Gia_ManObjNum(pGia) );
+    p->vCut   = Vec_IntStartFull( Gia_ManObjNum(pGia) );
+    p->vGraph = Vec_IntStartFull( Gia_ManObjNum(pGia) );
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        LevelMax = p->fUpdateLevel ? Gia_ObjLevel(pGia, pObj) : ABC_INFINITY;
+        for ( c = 1; c < p->pnCuts[i]; c++ )
+        {
+            pCut = Rwr_GiaObjCuts( p, i ) + c;
+            if ( pCut->nLeaves < 4 )
+                continue;
+            // skip cuts with too many single-fanout leaves
+            for ( Counter = k = 0; k < 4; k++ )
+                Counter += (Gia_ObjRefNumId(pGia, pCut->pLeaves[k]) == 1);
+            if ( Counter > 2 )
+                continue;
+            p->nCutsTried++;
+            nSaved = Rwr_GiaCutMffc( pGia, pObj, pCut, NULL );
+            Rwr_GiaCutLeafLits( p, pCut, pLits );
+            Class = p->pRwr->pMap[pCut->uTruth];
+            for ( g = Vec_IntEntry(p->vClassBeg, Class); g < Vec_IntEntry(p->vClassBeg, Class+1); g++ )
+            {
+                nAdded = Rwr_GiaGraphCount( pGia, (Dec_Graph_t *)Vec_PtrEntry(p->vGraphs, g), pLits, nSaved, LevelMax );
+                if ( nAdded == -1 || Vec_IntEntry(p->vGain, i) >= nSaved - nAdded )
+                    continue;
+                Vec_IntWriteEntry( p->vGain,  i, nSaved - nAdded );
+                Vec_IntWriteEntry( p->vCut,   i, c );
+                Vec_IntWriteEntry( p->vGraph, i, g );
+            }
+        }
+        if ( Vec_IntEntry(p->vGain, i) > 0 || (p->fUseZeros && Vec_IntEntry(p->vGain, i) == 0) )
+            p->nCands++;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects non-conflicting replacements.]
+
+  Description [Candidates are considered in the order of decreasing gain.
+  A candidate is accepted if its MFFC does not overlap with the MFFCs and
+  the leaves of the previously accepted candidates. Uses fMark0 to label
+  the removed nodes and fMark1 to label the leaves of accepted cuts.
+  Returns the array of accepted roots.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Int_t * Rwr_GiaSelect( Rwr_GiaMan_t * p )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Vec_Int_t * vRoots = Vec_IntAlloc( p->nCands );
+    Vec_Wec_t * vBuckets = Vec_WecStart( 1 );
+    Vec_Int_t * vLevel;
+    Rwr_GiaCut_t * pCut;
+    int i, k, Gain, iObj, iNode;
+    Vec_IntForEachEntry( p->vGain, Gain, i )
+        if ( Gain > 0 || (p->fUseZeros && Gain == 0) )
+            Vec_WecPush( vBuckets, Gain, i );
+    Vec_WecForEachLevelReverse( vBuckets, vLevel, Gain )
+    Vec_IntForEachEntry( vLevel, iObj, i )
+    {
+        pCut = Rwr_GiaObjCuts( p, iObj ) + Vec_IntEntry(p->vCut, iObj);
+        for ( k = 0; k < (int)pCut->nLeaves; k++ )
+            if ( Gia_ManObj(pGia, pCut->pLeaves[k])->fMark0 )
+                break;
+        if ( k < (int)pCut->nLeaves )
+            continue;
+        Vec_IntClear( p->vNodes );
+        Rwr_GiaCutMffc( pGia, Gia_ManObj(pGia, iObj), pCut, p->vNodes );
+        Vec_IntForEachEntry( p->vNodes, iNode, k )
+            if ( Gia_ManObj(pGia, iNode)->fMark0 || Gia_ManObj(pGia, iNode)->fMark1 )
+                break;
+        if ( k < Vec_IntSize(p->vNodes) )
+            continue;
+        Vec_IntForEachEntry( p->vNodes, iNode, k )
+            Gia_ManObj(pGia, iNode)->fMark0 = 1;
+        for ( k = 0; k < (int)pCut->nLeaves; k++ )
+            Gia_ManObj(pGia, pCut->pLeaves[k])->fMark1 = 1;
+        Vec_IntPush( vRoots, iObj );
+    }
+    Vec_WecFree( vBuckets );
+    Gia_ManCleanMark01( pGia );
+    return vRoots;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the rewritten AIG.]
+
+  Description [Only the logic reachable from the COs is constructed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Rwr_GiaBuild_rec( Gia_Man_t * pNew, Rwr_GiaMan_t * p, Gia_Obj_t * pObj )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Dec_Graph_t * pGraph;
+    Dec_Node_t * pNode;
+    Rwr_GiaCut_t * pCut;
+    int pLits[4];
+    int i, iObj = Gia_ObjId(pGia, pObj);
+    if ( ~pObj->Value )
+        return pObj->Value;
+    assert( Gia_ObjIsAnd(pObj) );
+    if ( Vec_IntEntry(p->vGraph, iObj) == -1 )
+    {
+        Rwr_GiaBuild_rec( pNew, p, Gia_ObjFanin0(pObj) );
+        Rwr_GiaBuild_rec( pNew, p, Gia_ObjFanin1(pObj) );
+        return pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    }
+    // build the replacement from the copies of the leaves
+    pCut   = Rwr_GiaObjCuts( p, iObj ) + Vec_IntEntry(p->vCut, iObj);
+    pGraph = (Dec_Graph_t *)Vec_PtrEntry( p->vGraphs, Vec_IntEntry(p->vGraph, iObj) );
+    Rwr_GiaCutLeafLits( p, pCut, pLits );
+    for ( i = 0; i < 4; i++ )
+    {
+        Gia_Obj_t * pLeaf = Gia_ManObj( pGia, Abc_Lit2Var(pLits[i]) );
+        pLits[i] = Abc_LitNotCond( Rwr_GiaBuild_rec(pNew, p, pLeaf), Abc_LitIsCompl(pLits[i]) );
+    }
+    if ( Dec_GraphIsConst(pGraph) )
+        pObj->Value = Abc_LitNotCond( 0, Dec_GraphIsComplement(pGraph) );
+    else if ( Dec_GraphIsVar(pGraph) )
+        pObj->Value = Abc_LitNotCond( pLits[Dec_GraphVarInt(pGraph)], Dec_GraphIsComplement(pGraph) );
+    else
+    {
+        Dec_GraphForEachLeaf( pGraph, pNode, i )
+            pNode->iFunc = pLits[i];
+        Dec_GraphForEachNode( pGraph, pNode, i )
+            pNode->iFunc = Gia_ManHashAnd( pNew,
+                Abc_LitNotCond( Dec_GraphNode(pGraph, pNode->eEdge0.Node)->iFunc, pNode->eEdge0.fCompl ),
+                Abc_LitNotCond( Dec_GraphNode(pGraph, pNode->eEdge1.Node)->iFunc, pNode->eEdge1.fCompl ) );
+        pObj->Value = Abc_LitNotCond( Dec_GraphNode(pGraph, pGraph->eRoot.Node)->iFunc, Dec_GraphIsComplement(pGraph) );
+    }
+    // account for the output phase of the canonical form
+    pObj->Value = Abc_LitNotCond( pObj->Value, (p->pRwr->pPhases[pCut->uTruth] >> 4) & 1 );
+    return pObj->Value;
+}
+static Gia_Man_t * Rwr_GiaDerive( Rwr_GiaMan_t * p, Vec_Int_t * vRoots )
+{
+    Gia_Man_t * pNew, * pTemp, * pGia = p->pGia;
+    Gia_Obj_t * pObj;
+    int i, iObj;
+    // keep the subgraphs of the accepted roots only
+    Vec_IntFill( p->vNodes, Gia_ManObjNum(pGia), -1 );
+    Vec_IntForEachEntry( vRoots, iObj, i )
+        Vec_IntWriteEntry( p->vNodes, iObj, Vec_IntEntry(p->vGraph, iObj) );
+    ABC_SWAP( Vec_Int_t *, p->vNodes, p->vGraph );
+    pNew = Gia_ManStart( Gia_ManObjNum(pGia) );
+    pNew->pName = Abc_UtilStrsav( pGia->pName );
+    pNew->pSpec = Abc_UtilStrsav( pGia->pSpec );
+    Gia_ManFillValue( pGia );
+    Gia_ManConst0(pGia)->Value = 0;
+    Gia_ManForEachCi( pGia, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManHashAlloc( pNew );
+    Gia_ManForEachCo( pGia, pObj, i )
+        Rwr_GiaBuild_rec( pNew, p, Gia_ObjFanin0(pObj) );
+    Gia_ManForEachCo( pGia, pObj, i )
+        pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManHashStop( pNew );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(pGia) );
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of batch rewriting.]
+
+  Description [Computes 4-input cuts of all nodes in one topological pass,
+  evaluates all cuts against the subgraphs of the NPN class of the cut
+  function without modifying the AIG, selects a non-conflicting set of
+  replacements, and rebuilds the AIG once. The AIG is expected to be
+  structurally hashed. If fUpdateLevel is set, the level of each node
+  does not increase.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Rwr_ManRewriteGia( Gia_Man_t * pGia, int fUpdateLevel, int fUseZeros, int fVerbose )
+{
+    Rwr_GiaMan_t * p;
+    Gia_Man_t * pNew;
+    Vec_Int_t * vRoots;
+    abctime clk, clkTotal = Abc_Clock();
+    p = ABC_CALLOC( Rwr_GiaMan_t, 1 );
+    p->pGia         = pGia;
+    p->pRwr         = Rwr_ManStart( 0 );
+    p->vNodes       = Vec_IntAlloc( 100 );
+    p->fUpdateLevel = fUpdateLevel;
+    p->fUseZeros    = fUseZeros;
+    Rwr_GiaIndexStart( p );
+    clk = Abc_Clock();
+    Rwr_GiaComputeCuts( p );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Cut computation", Abc_Clock() - clk );
+    clk = Abc_Clock();
+    Gia_ManLevelNum( pGia );
+    Gia_ManCreateRefs( pGia );
+    Gia_ManHashStart( pGia );
+    Rwr_GiaEvaluate( p );
+    vRoots = Rwr_GiaSelect( p );
+    Gia_ManHashStop( pGia );
+    ABC_FREE( pGia->pRefs );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Evaluation     ", Abc_Clock() - clk );
+    clk = Abc_Clock();
+    pNew = Rwr_GiaDerive( p, vRoots );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Rebuilding     ", Abc_Clock() - clk );
+    if ( fVerbose )
+    {
+        printf( "Cuts tried = %d.  Candidates = %d.  Rewritten = %d.  Nodes: %d -> %d.  ",
+            p->nCutsTried, p->nCands, Vec_IntSize(vRoots), Gia_ManAndNum(pGia), Gia_ManAndNum(pNew) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    }
+    Vec_IntFree( vRoots );
+    Vec_IntFree( p->vClassBeg );
+    Vec_PtrFree( p->vGraphs );
+    Vec_IntFree( p->vGain );
+    Vec_IntFree( p->vCut );
+    Vec_IntFree( p->vGraph );
+    Vec_IntFree( p->vNodes );
+    ABC_FREE( p->pCuts );
+    ABC_FREE( p->pnCuts );
+    Rwr_ManStop( p->pRwr );
+    ABC_FREE( p );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -52,6 +52,7 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
     pPars->nWinSizeMax  =  300;  // the maximum window size
     pPars->nGrowthLevel =    0;  // the maximum allowed growth in level
     pPars->nBTLimit     = 5000;  // the maximum number of conflicts in one SAT run
+    pPars->nProcs       =    1;  // the number of concurrent threads
     pPars->fRrOnly      =    0;  // perform redundancy removal
     pPars->fArea        =    0;  // performs optimization for area
     pPars->fMoreEffort  =    0;  // performs high-affort minimization
@@ -95,6 +96,8 @@ void Sfm_NtkPrintStats( Sfm_Ntk_t * p )
     ABC_PRTP( "Sat", p->timeSat  ,  p->timeTotal );
     ABC_PRTP( "Oth", p->timeOther,  p->timeTotal );
     ABC_PRTP( "ALL", p->timeTotal,  p->timeTotal );
+    if ( p->timeWorkers )
+    ABC_PRT( "Workers' CPU time (not included above)", p->timeWorkers );
 //    ABC_PRTP( "   ", p->time1    ,  p->timeTotal );
 }
 
@@ -213,6 +216,14 @@ finish:
         p->nResubs++;
     if ( fSkipUpdate )
         return 0;
+    // record the change to be committed later
+    if ( p->fDelayUpdate )
+    {
+        p->UpdFanin    = f;
+        p->UpdFaninNew = (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar));
+        p->UpdTruth    = uTruth;
+        return 1;
+    }
     // update the network
     Sfm_NtkUpdate( p, iNode, f, (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar)), uTruth );
     return 1;
@@ -274,6 +285,14 @@ p->timeSat += Abc_Clock() - clk;
     p->nImproves++;
     if ( fSkipUpdate )
         return 0;
+    // record the change to be committed later
+    if ( p->fDelayUpdate )
+    {
+        p->UpdFanin    = -1;
+        p->UpdFaninNew = -1;
+        p->UpdTruth    = uTruth;
+        return 1;
+    }
     // update truth table
     Vec_WrdWriteEntry( p->vTruths, iNode, uTruth );
     Sfm_TruthToCnf( uTruth, NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
@@ -376,6 +395,9 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 //    return 0;
     p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
+    if ( pPars->nProcs > 1 )
+        Counter = Sfm_NtkPerformPar( p );
+    else
     Sfm_NtkForEachNode( p, i )
     {
         if ( Sfm_ObjIsFixed( p, i ) )
@@ -123,6 +123,11 @@ struct Sfm_Ntk_t_
     Vec_Int_t *       vValues;     // SAT variable values
     Vec_Wec_t *       vClauses;    // CNF clauses for the node
     Vec_Int_t *       vFaninMap;   // mapping fanins into their SAT vars
+    // delayed update
+    int               fDelayUpdate;// record the change instead of updating the network
+    int               UpdFanin;    // the fanin to be replaced (-1 if the function changes)
+    int               UpdFaninNew; // the new fanin (-1 if the fanin is removed)
+    word              UpdTruth;    // the new truth table
     // nodes
     int               nTotalNodesBeg;
     int               nTotalEdgesBeg;
@@ -140,6 +145,7 @@ struct Sfm_Ntk_t_
     abctime           timeSat;
     abctime           timeOther;
     abctime           timeTotal;
+    abctime           timeWorkers; // CPU time of concurrent workers
 //    abctime           time1;
 };
 
@@ -203,6 +209,7 @@ extern int          Sfm_TruthToCnf( word Truth, word * pTruth, int nVars, Vec_In
 extern Vec_Wec_t *  Sfm_CreateCnf( Sfm_Ntk_t * p );
 extern void         Sfm_TranslateCnf( Vec_Wec_t * vRes, Vec_Str_t * vCnf, Vec_Int_t * vFaninMap, int iPivotVar );
 /*=== sfmCore.c ==========================================================*/
+extern int          Sfm_NodeResub( Sfm_Ntk_t * p, int iNode );
 /*=== sfmLib.c ==========================================================*/
 extern int          Sfm_LibFindComplInputGate( Vec_Wrd_t * vFuncs, int iGate, int nFanins, int iFanin, int * piFaninNew );
 extern Sfm_Lib_t *  Sfm_LibPrepare( int nVars, int fTwo, int fDelay, int fVerbose, int fLibVerbose );
@@ -217,6 +224,8 @@ extern int          Sfm_LibImplementGatesDelay( Sfm_Lib_t * p, int * pFanins, Mi
 extern Sfm_Ntk_t *  Sfm_ConstructNetwork( Vec_Wec_t * vFanins, int nPis, int nPos );
 extern void         Sfm_NtkPrepare( Sfm_Ntk_t * p );
 extern void         Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth );
+/*=== sfmPar.c ==========================================================*/
+extern int          Sfm_NtkPerformPar( Sfm_Ntk_t * p );
 /*=== sfmSat.c ==========================================================*/
 extern int          Sfm_NtkWindowToSolver( Sfm_Ntk_t * p );
 extern word         Sfm_ComputeInterpolant( Sfm_Ntk_t * p );
@@ -0,0 +1,410 @@
+/**CFile****************************************************************
+
+  FileName    [sfmPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based optimization using internal don't-cares.]
+
+  Synopsis    [Concurrent resubstitution in non-overlapping windows.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: sfmPar.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "sfmInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define SFM_THR_MAX    100   // the max number of threads
+#define SFM_THR_BATCH   32   // the number of nodes per thread in one batch
+
+typedef struct Sfm_Res_t_ Sfm_Res_t;
+struct Sfm_Res_t_
+{
+    int               iNode;       // the node
+    int               fChange;     // the node can be changed
+    int               Fanin;       // the fanin to be replaced (-1 if the function changes)
+    int               FaninNew;    // the new fanin (-1 if the fanin is removed)
+    word              uTruth;      // the new truth table
+    Vec_Int_t *       vFoot;       // objects of the window (except CIs)
+    Vec_Int_t *       vTfo;        // TFO of the node in the window
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the worker sharing the network with the manager.]
+
+  Description [The worker reads the network of the manager but has its own
+  traversal IDs, SAT variable maps, window arrays, and SAT solver.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sfm_Ntk_t * Sfm_NtkStartWorker( Sfm_Ntk_t * p )
+{
+    Sfm_Ntk_t * pW = ABC_ALLOC( Sfm_Ntk_t, 1 );
+    memcpy( pW, p, sizeof(Sfm_Ntk_t) );
+    pW->pPars = ABC_ALLOC( Sfm_Par_t, 1 );
+    memcpy( pW->pPars, p->pPars, sizeof(Sfm_Par_t) );
+    pW->pPars->fVeryVerbose = 0;
+    memset( &pW->vCounts,   0, sizeof(Vec_Int_t) );
+    memset( &pW->vTravIds,  0, sizeof(Vec_Int_t) );
+    memset( &pW->vTravIds2, 0, sizeof(Vec_Int_t) );
+    memset( &pW->vId2Var,   0, sizeof(Vec_Int_t) );
+    memset( &pW->vVar2Id,   0, sizeof(Vec_Int_t) );
+    Vec_IntFill( &pW->vCounts,   p->nObjs,  0 );
+    Vec_IntFill( &pW->vTravIds,  p->nObjs,  0 );
+    Vec_IntFill( &pW->vTravIds2, p->nObjs,  0 );
+    Vec_IntFill( &pW->vId2Var,   2*p->nObjs, -1 );
+    Vec_IntFill( &pW->vVar2Id,   2*p->nObjs, -1 );
+    pW->nTravIds  = 0;
+    pW->nTravIds2 = 0;
+    pW->nSatVars  = 0;
+    pW->vCover    = Vec_IntAlloc( 1 << 16 );
+    Sfm_NtkPrepare( pW );
+    // clean statistics
+    pW->nTryRemoves = pW->nTryImproves = pW->nTryResubs = 0;
+    pW->nRemoves = pW->nImproves = pW->nResubs = 0;
+    pW->nNodesTried = pW->nTotalDivs = pW->nSatCalls = pW->nTimeOuts = pW->nMaxDivs = 0;
+    pW->timeWin = pW->timeDiv = pW->timeCnf = pW->timeSat = 0;
+    pW->fDelayUpdate = 1;
+    return pW;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the worker and adds its statistics to the manager.]
+
+  Description [The runtime of the worker is CPU time spent in another
+  thread, so it is accumulated separately from the runtime of the manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sfm_NtkStopWorker( Sfm_Ntk_t * p, Sfm_Ntk_t * pW )
+{
+    p->nTryRemoves  += pW->nTryRemoves;
+    p->nTryImproves += pW->nTryImproves;
+    p->nTryResubs   += pW->nTryResubs;
+    p->nNodesTried  += pW->nNodesTried;
+    p->nTotalDivs   += pW->nTotalDivs;
+    p->nSatCalls    += pW->nSatCalls;
+    p->nTimeOuts    += pW->nTimeOuts;
+    p->nMaxDivs     += pW->nMaxDivs;
+    p->timeWorkers  += pW->timeWin + pW->timeDiv + pW->timeCnf + pW->timeSat;
+    ABC_FREE( pW->vCounts.pArray );
+    ABC_FREE( pW->vTravIds.pArray );
+    ABC_FREE( pW->vTravIds2.pArray );
+    ABC_FREE( pW->vId2Var.pArray );
+    ABC_FREE( pW->vVar2Id.pArray );
+    Vec_IntFree( pW->vCover );
+    Vec_IntFreeP( &pW->vNodes );
+    Vec_IntFreeP( &pW->vDivs  );
+    Vec_IntFreeP( &pW->vRoots );
+    Vec_IntFreeP( &pW->vTfo   );
+    Vec_WrdFreeP( &pW->vDivCexes );
+    Vec_IntFreeP( &pW->vOrder );
+    Vec_IntFreeP( &pW->vDivVars );
+    Vec_IntFreeP( &pW->vDivIds );
+    Vec_IntFreeP( &pW->vLits  );
+    Vec_IntFreeP( &pW->vValues );
+    Vec_WecFreeP( &pW->vClauses );
+    Vec_IntFreeP( &pW->vFaninMap );
+    if ( pW->pSat ) sat_solver_delete( pW->pSat );
+    ABC_FREE( pW->pPars );
+    ABC_FREE( pW );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates one node without changing the network.]
+
+  Description [Records the change, the objects of the window whose logic
+  the change depends on, and the TFO of the node whose functions may be
+  modified by the change. The window contains the complete TFI of the
+  node. The CIs are skipped because no change can modify them.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sfm_NtkWorkerResub( Sfm_Ntk_t * pW, Sfm_Res_t * pRes )
+{
+    int i, iObj;
+    pRes->fChange = Sfm_NodeResub( pW, pRes->iNode );
+    Vec_IntClear( pRes->vFoot );
+    Vec_IntClear( pRes->vTfo );
+    if ( !pRes->fChange )
+        return;
+    pRes->Fanin    = pW->UpdFanin;
+    pRes->FaninNew = pW->UpdFaninNew;
+    pRes->uTruth   = pW->UpdTruth;
+    Vec_IntForEachEntry( pW->vOrder, iObj, i )
+        if ( !Sfm_ObjIsPi(pW, iObj) )
+            Vec_IntPush( pRes->vFoot, iObj );
+    Vec_IntAppend( pRes->vTfo, pW->vTfo );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks if the change can be committed.]
+
+  Description [The change is rejected if an object of its window was 
+  modified by an earlier commit of the same batch, or if the new fanin
+  violates the level limit after the levels were updated by these commits.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkCheckChange( Sfm_Ntk_t * p, Sfm_Res_t * pRes, Vec_Int_t * vStamps, int Stamp )
+{
+    int i, iObj;
+    Vec_IntForEachEntry( pRes->vFoot, iObj, i )
+        if ( Vec_IntEntry(vStamps, iObj) == Stamp )
+            return 0;
+    if ( pRes->FaninNew >= 0 && Sfm_ObjLevel(p, pRes->FaninNew) > p->nLevelMax - Sfm_ObjLevelR(p, pRes->iNode) )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Marks the objects modified by the committed change.]
+
+  Description [These are the node, its TFO in the window (whose functions
+  may change within the don't-cares), the new fanin (which gets a new 
+  fanout), and the nodes of the window deleted by the update.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sfm_NtkMarkChange( Sfm_Ntk_t * p, Sfm_Res_t * pRes, Vec_Int_t * vStamps, int Stamp )
+{
+    int i, iObj;
+    Vec_IntWriteEntry( vStamps, pRes->iNode, Stamp );
+    Vec_IntForEachEntry( pRes->vTfo, iObj, i )
+        Vec_IntWriteEntry( vStamps, iObj, Stamp );
+    if ( pRes->FaninNew >= 0 )
+        Vec_IntWriteEntry( vStamps, pRes->FaninNew, Stamp );
+    Vec_IntForEachEntry( pRes->vFoot, iObj, i )
+        if ( Sfm_ObjIsNode(p, iObj) && Sfm_ObjFanoutNum(p, iObj) == 0 )
+            Vec_IntWriteEntry( vStamps, iObj, Stamp );
+}
+
+#ifndef ABC_USE_PTHREADS
+
+void Sfm_NtkResubBatch( Sfm_Ntk_t ** pWorkers, Sfm_Res_t * pRes, int nRes, int nProcs )
+{
+    int i;
+    for ( i = 0; i < nRes; i++ )
+        Sfm_NtkWorkerResub( pWorkers[0], pRes + i );
+}
+
+#else // pthreads are used
+
+typedef struct Sfm_ThData_t_
+{
+    Sfm_Ntk_t *       pW;          // the worker
+    Sfm_Res_t *       pRes;        // the nodes of the batch
+    int               nRes;        // the number of nodes in the batch
+    int *             pNext;       // the next node to evaluate
+} Sfm_ThData_t;
+
+static pthread_mutex_t s_SfmParMutex = PTHREAD_MUTEX_INITIALIZER;
+
+void * Sfm_NtkWorkerThread( void * pArg )
+{
+    Sfm_ThData_t * pThData = (Sfm_ThData_t *)pArg;
+    int i, status;
+    while ( 1 )
+    {
+        status = pthread_mutex_lock( &s_SfmParMutex );  assert( status == 0 );
+        i = (*pThData->pNext)++;
+        status = pthread_mutex_unlock( &s_SfmParMutex );  assert( status == 0 );
+        if ( i >= pThData->nRes )
+            break;
+        Sfm_NtkWorkerResub( pThData->pW, pThData->pRes + i );
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+void Sfm_NtkResubBatch( Sfm_Ntk_t ** pWorkers, Sfm_Res_t * pRes, int nRes, int nProcs )
+{
+    pthread_t WorkerThread[SFM_THR_MAX];
+    Sfm_ThData_t ThData[SFM_THR_MAX];
+    int i, status, iNext = 0;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pW    = pWorkers[i];
+        ThData[i].pRes  = pRes;
+        ThData[i].nRes  = nRes;
+        ThData[i].pNext = &iNext;
+        status = pthread_create( WorkerThread + i, NULL, Sfm_NtkWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution using concurrent threads.]
+
+  Description [Nodes are processed in batches. The nodes of a batch are
+  evaluated concurrently by the workers, each with its own SAT solver,
+  without modifying the network. The changes are then committed in the
+  topological order. A change is committed only if none of the objects
+  in its window was modified by the earlier commits of the same batch
+  and its new fanin still satisfies the level limit. Both the changed 
+  nodes and the nodes whose change was rejected are queued to be 
+  evaluated again by the workers in a later batch, so the manager only 
+  applies the changes and never calls the SAT solver. As in the 
+  sequential flow, a queued node is skipped if it no longer qualifies 
+  when its batch is formed. Returns the number of changed nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkPerformPar( Sfm_Ntk_t * p )
+{
+    Sfm_Ntk_t * pWorkers[SFM_THR_MAX];
+    Sfm_Res_t * pRes, * pBatch;
+    Vec_Int_t * vCands = Vec_IntAlloc( p->nNodes );
+    Vec_Int_t * vStamps = Vec_IntStart( p->nObjs );
+    Vec_Bit_t * vCounted = Vec_BitStart( p->nObjs );
+    int nProcs = Abc_MinInt( p->pPars->nProcs, SFM_THR_MAX );
+    int nBatch = nProcs * SFM_THR_BATCH;
+    int i, b, iNode, nRes, Stamp, Counter = 0, nEvals = 0, nConflicts = 0;
+    // collect candidate nodes
+    Sfm_NtkForEachNode( p, i )
+        if ( !Sfm_ObjIsFixed( p, i ) )
+            Vec_IntPush( vCands, i );
+    // start the workers
+    for ( i = 0; i < nProcs; i++ )
+        pWorkers[i] = Sfm_NtkStartWorker( p );
+    pBatch = ABC_CALLOC( Sfm_Res_t, nBatch );
+    for ( i = 0; i < nBatch; i++ )
+    {
+        pBatch[i].vFoot = Vec_IntAlloc( 100 );
+        pBatch[i].vTfo  = Vec_IntAlloc( 100 );
+    }
+    for ( b = 0, Stamp = 1; b < Vec_IntSize(vCands); Stamp++ )
+    {
+        // collect the nodes of the batch
+        for ( nRes = 0; nRes < nBatch && b < Vec_IntSize(vCands); b++ )
+        {
+            iNode = Vec_IntEntry( vCands, b );
+            if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, iNode) > p->pPars->nDepthMax )
+                continue;
+            if ( Sfm_ObjFaninNum(p, iNode) < 2 || Sfm_ObjFaninNum(p, iNode) > 6 )
+                continue;
+            pBatch[nRes++].iNode = iNode;
+        }
+        if ( nRes == 0 )
+            break;
+        // evaluate the nodes of the batch concurrently
+        Sfm_NtkResubBatch( pWorkers, pBatch, nRes, nProcs );
+        nEvals += nRes;
+        // commit the changes
+        for ( i = 0; i < nRes; i++ )
+        {
+            pRes = pBatch + i;
+            if ( !pRes->fChange )
+                continue;
+            if ( !Sfm_NtkCheckChange( p, pRes, vStamps, Stamp ) )
+                nConflicts++;
+            else
+            {
+                if ( pRes->Fanin == -1 )
+                {
+                    p->nImproves++;
+                    Vec_WrdWriteEntry( p->vTruths, pRes->iNode, pRes->uTruth );
+                    Sfm_TruthToCnf( pRes->uTruth, NULL, Sfm_ObjFaninNum(p, pRes->iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, pRes->iNode) );
+                }
+                else
+                {
+                    if ( pRes->FaninNew == -1 )
+                        p->nRemoves++;
+                    else
+                        p->nResubs++;
+                    Sfm_NtkUpdate( p, pRes->iNode, pRes->Fanin, pRes->FaninNew, pRes->uTruth );
+                }
+                Sfm_NtkMarkChange( p, pRes, vStamps, Stamp );
+                if ( !Vec_BitEntry(vCounted, pRes->iNode) )
+                {
+                    Vec_BitWriteEntry( vCounted, pRes->iNode, 1 );
+                    if ( ++Counter == p->pPars->nNodesMax )
+                        break;
+                }
+            }
+            // revisit this node in the updated network
+            Vec_IntPush( vCands, pRes->iNode );
+        }
+        if ( i < nRes )
+            break;
+    }
+    for ( i = 0; i < nProcs; i++ )
+        Sfm_NtkStopWorker( p, pWorkers[i] );
+    for ( i = 0; i < nBatch; i++ )
+    {
+        Vec_IntFree( pBatch[i].vFoot );
+        Vec_IntFree( pBatch[i].vTfo );
+    }
+    ABC_FREE( pBatch );
+    if ( p->pPars->fVerbose )
+        printf( "Used %d threads to perform %d node evaluations in batches of %d. Conflicts = %d.\n", nProcs, nEvals, nBatch, nConflicts );
+    Vec_IntFree( vCands );
+    Vec_IntFree( vStamps );
+    Vec_BitFree( vCounted );
+    return Counter;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
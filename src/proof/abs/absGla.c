@@ -62,6 +62,8 @@ struct Ga2_Man_t_
     int            nCexes;       // the number of counter-examples
     int            nObjAdded;    // objs added during refinement
     int            nPdrCalls;    // count the number of concurrent calls
+    int            nBmcCalls;    // count the number of concurrent BMC runs
+    int            nBmcFrames;   // frames whose checking was skipped due to concurrent BMC
     // hash table
     int *          pTable;
     int            nTable;
@@ -469,6 +471,9 @@ void Ga2_ManStop( Ga2_Man_t * p )
     if ( p->pPars->fVerbose )
     Abc_Print( 1, "Hash hits = %d.  Hash misses = %d.  Hash overs = %d.  Concurrent calls = %d.\n", 
         p->nHashHit, p->nHashMiss, p->nHashOver, p->nPdrCalls );
+    if ( p->pPars->fVerbose && p->pPars->fBmcThread )
+    Abc_Print( 1, "Concurrent BMC runs = %d.  Frames proved by concurrent BMC = %d.\n", 
+        p->nBmcCalls, p->nBmcFrames );
 
     if( p->pSat ) sat_solver2_delete( p->pSat );
     Vec_VecFree( (Vec_Vec_t *)p->vCnfs );
@@ -1503,7 +1508,7 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
     Ga2_Man_t * p;
     Vec_Int_t * vCore, * vPPis;
     abctime clk2, clk = Abc_Clock();
-    int Status = l_Undef, RetValue = -1, iFrameTryToProve = -1, fOneIsSent = 0;
+    int Status = l_Undef, RetValue = -1, iFrameTryToProve = -1, fOneIsSent = 0, nAbsBmc = -1;
     int i, c, f, Lit;
     pPars->iFrame = -1;
     // check trivial case 
@@ -1627,6 +1632,15 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
                     Prf_ManStopP( &p->pSat->pPrf2 );
                     break;
                 }
+                // skip solving if BMC running in the background (&gla -k) has already shown
+                // that an earlier (hence, weaker) abstraction has no counter-example in this frame
+                if ( c == 0 && pPars->fBmcThread && f <= Gia_GlaBmcFrameProved() )
+                {
+                    if ( f > p->pPars->iFrameProved )
+                        p->pPars->nFramesNoChange++;
+                    p->nBmcFrames++;
+                    break;
+                }
                 // perform SAT solving
                 clk2 = Abc_Clock();
                 Status = sat_solver2_solve( p->pSat, &Lit, &Lit+1, (ABC_INT64_T)pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
@@ -1789,6 +1803,13 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
                     goto finish;
                 }
             }
+            // run BMC on the current abstraction in the background (&gla -k)
+            if ( pPars->fBmcThread && !Gia_GlaBmcIsRunning() && nAbsBmc != Vec_IntSize(p->vAbs) )
+            {
+                Gia_GlaBmcAbsracted( pAig, pPars->fVeryVerbose );
+                nAbsBmc = Vec_IntSize(p->vAbs);
+                p->nBmcCalls++;
+            }
             // check the number of stable frames
             if ( p->pPars->nFramesNoChange == p->pPars->nFramesNoChangeLim )
             {
@@ -1842,6 +1863,9 @@ finish:
     // cancel old one if it is proving
     if ( iFrameTryToProve >= 0 )
         Gia_GlaProveCancel( pPars->fVerbose );
+    // cancel BMC running in the background
+    if ( pPars->fBmcThread )
+        Gia_GlaBmcCancel( pPars->fVerbose );
     // analize the results
     if ( !p->fUseNewLine )
         Abc_Print( 1, "\n" );
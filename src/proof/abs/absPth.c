@@ -21,6 +21,7 @@
 #include "abs.h"
 #include "proof/pdr/pdr.h"
 #include "proof/ssw/ssw.h"
+#include "sat/bmc/bmc.h"
 
 
 #ifdef ABC_USE_PTHREADS
@@ -45,6 +46,10 @@ ABC_NAMESPACE_IMPL_START
 void Gia_GlaProveAbsracted( Gia_Man_t * p, int fSimpProver, int fVerbose ) {}
 void Gia_GlaProveCancel( int fVerbose )                                    {}
 int  Gia_GlaProveCheck( int fVerbose )                                     { return 0; }
+void Gia_GlaBmcAbsracted( Gia_Man_t * p, int fVerbose )                   {}
+void Gia_GlaBmcCancel( int fVerbose )                                      {}
+int  Gia_GlaBmcIsRunning()                                                 { return 0; }
+int  Gia_GlaBmcFrameProved()                                               { return -1; }
 
 #else // pthreads are used
 
@@ -60,10 +65,26 @@ typedef struct Abs_ThData_t_
 pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
 static volatile int g_nRunIds = 0;             // the number of the last prover instance
 static volatile int g_fAbstractionProved = 0;  // set to 1 when prover successed to prove
+static volatile int g_nBmcRunIds = 0;          // the number of the last BMC instance
+static volatile int g_fBmcRunning = 0;         // set to 1 while the last BMC instance is running
+static volatile int g_iFrameBmcProved = -1;    // the last frame where BMC proved the abstraction
 
 // call back procedure for PDR
 int Abs_CallBackToStop( int RunId ) { assert( RunId <= g_nRunIds ); return RunId < g_nRunIds; }
 
+// call back procedures for BMC
+int Abs_CallBackToStopBmc( int RunId ) { assert( RunId <= g_nBmcRunIds ); return RunId < g_nBmcRunIds; }
+void Abs_CallBackOnFrameDone( int RunId, int iFrame, int iPo, int Status )
+{
+    int status;
+    if ( Status != 0 )
+        return;
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    if ( RunId == g_nBmcRunIds && g_iFrameBmcProved < iFrame )
+        g_iFrameBmcProved = iFrame;
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+}
+
 // test procedure to replace PDR
 int Pdr_ManSolve_test( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
 {
@@ -194,6 +215,97 @@ int Gia_GlaProveCheck( int fVerbose )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Runs BMC on the current abstraction in a separate thread.]
+
+  Description [The abstraction only grows during refinement. Therefore,
+  a timeframe where BMC did not find a counter-example for an earlier 
+  abstraction does not have a counter-example for the current one, 
+  and the main loop of GLA can skip calling the SAT solver in it.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abs_BmcThread( void * pArg )
+{
+    Abs_ThData_t * pThData = (Abs_ThData_t *)pArg;
+    Saig_ParBmc_t Pars, * pPars = &Pars;
+    int RetValue, status;
+    // call BMC
+    Saig_ParBmcSetDefaultParams( pPars );
+    pPars->fSilent          = 1;
+    pPars->fNotVerbose      = 1;
+    pPars->RunId            = pThData->RunId;
+    pPars->pFuncStop        = Abs_CallBackToStopBmc;
+    pPars->pFuncOnFrameDone = Abs_CallBackOnFrameDone;
+    RetValue = Saig_ManBmcScalable( pThData->pAig, pPars );
+    // update the status
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    if ( pThData->RunId == g_nBmcRunIds )
+        g_fBmcRunning = 0;
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+    if ( pThData->fVerbose )
+    {
+        if ( RetValue == 0 )
+            Abc_Print( 1, "BMC found a counter-example to abstraction %d in frame %d.\n", pThData->RunId, pPars->iFrame );
+        else
+            Abc_Print( 1, "BMC stopped on abstraction %d after frame %d.\n", pThData->RunId, pPars->iFrame );
+    }
+    // free memory
+    Aig_ManStop( pThData->pAig );
+    ABC_FREE( pThData );
+    // quit this thread
+    pthread_exit( NULL );
+    assert(0);
+    return NULL;
+}
+void Gia_GlaBmcAbsracted( Gia_Man_t * pGia, int fVerbose )
+{
+    Abs_ThData_t * pThData;
+    Aig_Man_t * pAig;
+    Gia_Man_t * pAbs;
+    pthread_t BmcThread;
+    int status;
+    // create abstraction 
+    assert( pGia->vGateClasses != NULL );
+    pAbs = Gia_ManDupAbsGates( pGia, pGia->vGateClasses );
+    Gia_ManCleanValue( pGia );
+    pAig = Gia_ManToAigSimple( pAbs );
+    Gia_ManStop( pAbs );
+    // collect thread data (starting a new run cancels the old one)
+    pThData = ABC_CALLOC( Abs_ThData_t, 1 );
+    pThData->pAig = pAig;
+    pThData->fVerbose = fVerbose;
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    pThData->RunId = ++g_nBmcRunIds;
+    g_fBmcRunning = 1;
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+    // create thread
+    if ( fVerbose )  Abc_Print( 1, "\nRunning BMC on abstraction %d.\n", pThData->RunId );
+    status = pthread_create( &BmcThread, NULL, Abs_BmcThread, pThData );
+    assert( status == 0 );
+}
+void Gia_GlaBmcCancel( int fVerbose )
+{
+    int status;
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    g_nBmcRunIds++;
+    g_fBmcRunning = 0;
+    g_iFrameBmcProved = -1;
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+}
+int Gia_GlaBmcIsRunning()
+{
+    return g_fBmcRunning;
+}
+int Gia_GlaBmcFrameProved()
+{
+    return g_iFrameBmcProved;
+}
+
 #endif // pthreads are used
 
 ////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,343 @@
+/**CFile****************************************************************
+
+  FileName    [cecProve.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Combinational equivalence checking.]
+
+  Synopsis    [Portfolio of sequential model checking engines.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: cecProve.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+#include "proof/pdr/pdr.h"
+#include "proof/int/int.h"
+#include "proof/ssw/ssw.h"
+#include "sat/bmc/bmc.h"
+#include "cec.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define CEC_PORT_ENGINES 4   // the number of engines in the portfolio
+
+static char * s_PortEngineNames[CEC_PORT_ENGINES] = { "pdr", "bmc3", "int", "sim3" };
+
+// information given to the thread
+typedef struct Cec_PortThData_t_ Cec_PortThData_t;
+struct Cec_PortThData_t_
+{
+    Aig_Man_t *  pAig;       // the private copy of the AIG
+    int          iEngine;    // the engine to run
+    int          RunId;      // the id of this portfolio run
+    int          nTimeOut;   // the timeout in seconds
+    int          RetValue;   // the result of the engine
+    int          fCexFail;   // the CEX produced by the engine is invalid
+    abctime      clkTotal;   // the runtime of the engine
+};
+
+static volatile int g_nPortRunIds = 0;   // the number of the last portfolio run
+static volatile int g_iPortWinner = -1;  // the engine that delivered the verdict
+
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_PortMutex = PTHREAD_MUTEX_INITIALIZER;
+static inline void Cec_PortLock()   { int status = pthread_mutex_lock( &s_PortMutex );    assert( status == 0 ); (void)status; }
+static inline void Cec_PortUnlock() { int status = pthread_mutex_unlock( &s_PortMutex );  assert( status == 0 ); (void)status; }
+#else
+static inline void Cec_PortLock()   {}
+static inline void Cec_PortUnlock() {}
+#endif
+
+// call back procedure for the engines
+int Cec_PortCallBackToStop( int RunId ) { assert( RunId <= g_nPortRunIds ); return RunId < g_nPortRunIds; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one engine of the portfolio.]
+
+  Description [Returns 1 if proved, 0 if disproved, -1 if undecided.
+  In the case of disproof, the CEX is stored in pAig->pSeqModel.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_PortRunEngine( Aig_Man_t * pAig, int iEngine, int RunId, int nTimeOut )
+{
+    int RetValue = -1;
+    if ( iEngine == 0 )
+    {
+        Pdr_Par_t Pars, * pPars = &Pars;
+        Pdr_ManSetDefaultParams( pPars );
+        pPars->nTimeOut   = nTimeOut;
+        pPars->fSilent    = 1;
+        pPars->RunId      = RunId;
+        pPars->pFuncStop  = Cec_PortCallBackToStop;
+        RetValue = Pdr_ManSolve( pAig, pPars );
+    }
+    else if ( iEngine == 1 )
+    {
+        Saig_ParBmc_t Pars, * pPars = &Pars;
+        Saig_ParBmcSetDefaultParams( pPars );
+        pPars->nTimeOut   = nTimeOut;
+        pPars->fNotVerbose = 1;
+        pPars->fSilent    = 1;
+        pPars->RunId      = RunId;
+        pPars->pFuncStop  = Cec_PortCallBackToStop;
+        // returns 1 only if all reachable states were explored
+        RetValue = Saig_ManBmcScalable( pAig, pPars );
+    }
+    else if ( iEngine == 2 )
+    {
+        Inter_ManParams_t Pars, * pPars = &Pars;
+        Aig_Man_t * pTemp;
+        int iFrame;
+        // interpolation works for one property without constraints
+        if ( Saig_ManPiNum(pAig) == 0 || Saig_ManConstrNum(pAig) > 0 )
+            return -1;
+        pTemp = Saig_ManPoNum(pAig) > 1 ? Saig_ManDupOrpos( pAig ) : pAig;
+        Inter_ManSetDefaultParams( pPars );
+        pPars->nSecLimit  = nTimeOut;
+        pPars->RunId      = RunId;
+        pPars->pFuncStop  = Cec_PortCallBackToStop;
+        RetValue = Inter_ManPerformInterpolation( pTemp, pPars, &iFrame );
+        if ( pTemp != pAig )
+        {
+            // find the output of the original AIG failed by the CEX
+            if ( pTemp->pSeqModel )
+            {
+                pAig->pSeqModel = pTemp->pSeqModel;
+                pTemp->pSeqModel = NULL;
+                pAig->pSeqModel->iPo = Saig_ManFindFailedPoCex( pAig, pAig->pSeqModel );
+            }
+            Aig_ManStop( pTemp );
+        }
+    }
+    else if ( iEngine == 3 )
+    {
+        Ssw_RarPars_t Pars, * pPars = &Pars;
+        Ssw_RarSetDefaultParams( pPars );
+        pPars->TimeOut    = nTimeOut;
+        pPars->fNotVerbose = 1;
+        pPars->fSilent    = 1;
+        pPars->RunId      = RunId;
+        pPars->pFuncStop  = Cec_PortCallBackToStop;
+        // simulation cannot prove the property
+        RetValue = Ssw_RarSimulate( pAig, pPars ) == 0 ? 0 : -1;
+    }
+    else assert( 0 );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the result of one engine.]
+
+  Description [A disproof counts only if the CEX is available and valid.
+  The first engine to deliver a verdict becomes the winner and cancels 
+  the others by advancing the run ID checked by their callbacks.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_PortReportResult( Cec_PortThData_t * pThData )
+{
+    Aig_Man_t * pAig = pThData->pAig;
+    if ( pThData->RetValue == 0 && pAig->pSeqModel == NULL )
+        pThData->RetValue = -1;
+    else if ( pThData->RetValue == 0 && (pAig->pSeqModel->iPo < 0 || !Saig_ManVerifyCex(pAig, pAig->pSeqModel)) )
+    {
+        pThData->fCexFail = 1;
+        pThData->RetValue = -1;
+    }
+    if ( pThData->RetValue == -1 )
+        return;
+    Cec_PortLock();
+    if ( pThData->RunId == g_nPortRunIds )
+    {
+        g_iPortWinner = pThData->iEngine;
+        g_nPortRunIds++;
+    }
+    Cec_PortUnlock();
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the engines.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+void * Cec_PortWorkerThread( void * pArg )
+{
+    Cec_PortThData_t * pThData = (Cec_PortThData_t *)pArg;
+    abctime clk = Abc_Clock();
+    pThData->RetValue = Cec_PortRunEngine( pThData->pAig, pThData->iEngine, pThData->RunId, pThData->nTimeOut );
+    pThData->clkTotal = Abc_Clock() - clk;
+    Cec_PortReportResult( pThData );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+void Cec_PortRunEngines( Cec_PortThData_t * pThData, int nEngines )
+{
+    pthread_t WorkerThread[CEC_PORT_ENGINES];
+    int i, status;
+    for ( i = 0; i < nEngines; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Cec_PortWorkerThread, (void *)(pThData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nEngines; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+}
+
+#else
+
+void Cec_PortRunEngines( Cec_PortThData_t * pThData, int nEngines )
+{
+    int i;
+    for ( i = 0; i < nEngines && g_iPortWinner == -1; i++ )
+    {
+        abctime clk = Abc_Clock();
+        pThData[i].RetValue = Cec_PortRunEngine( pThData[i].pAig, pThData[i].iEngine, pThData[i].RunId, pThData[i].nTimeOut );
+        pThData[i].clkTotal = Abc_Clock() - clk;
+        Cec_PortReportResult( pThData + i );
+    }
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the portfolio of sequential engines.]
+
+  Description [Launches PDR, BMC, interpolation, and rarity simulation
+  concurrently, each on its own copy of the AIG, and returns the first
+  verdict: 1 if proved, 0 if disproved (the CEX is stored in p->pCexSeq),
+  -1 if undecided. The timeout applies to each engine.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaProvePortfolio( Gia_Man_t * p, int nTimeOut, int fVerbose )
+{
+    Cec_PortThData_t ThData[CEC_PORT_ENGINES];
+    abctime clkMax = 0;
+    int i, RunId, iWinner, RetValue = -1;
+    assert( Gia_ManRegNum(p) > 0 );
+    ABC_FREE( p->pCexSeq );
+    // start a new run
+    Cec_PortLock();
+    RunId = ++g_nPortRunIds;
+    g_iPortWinner = -1;
+    Cec_PortUnlock();
+    for ( i = 0; i < CEC_PORT_ENGINES; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Cec_PortThData_t) );
+        ThData[i].pAig     = Gia_ManToAigSimple( p );
+        ThData[i].iEngine  = i;
+        ThData[i].RunId    = RunId;
+        ThData[i].nTimeOut = nTimeOut;
+        ThData[i].RetValue = -1;
+    }
+    Cec_PortRunEngines( ThData, CEC_PORT_ENGINES );
+    // close this run if no engine has delivered a verdict
+    Cec_PortLock();
+    if ( g_nPortRunIds == RunId )
+        g_nPortRunIds++;
+    iWinner = g_iPortWinner;
+    Cec_PortUnlock();
+    // report the results
+    for ( i = 0; i < CEC_PORT_ENGINES; i++ )
+    {
+        if ( clkMax < ThData[i].clkTotal )
+            clkMax = ThData[i].clkTotal;
+        if ( ThData[i].fCexFail )
+            Abc_Print( 1, "Cec_GiaProvePortfolio(): Counter-example produced by engine \"%s\" is invalid.\n", s_PortEngineNames[i] );
+        if ( !fVerbose )
+            continue;
+        Abc_Print( 1, "Engine %-5s : ", s_PortEngineNames[i] );
+        if ( ThData[i].RetValue == 1 )
+            Abc_Print( 1, "proved     " );
+        else if ( ThData[i].RetValue == 0 )
+            Abc_Print( 1, "disproved  " );
+        else if ( i != iWinner && iWinner >= 0 )
+            Abc_Print( 1, "cancelled  " );
+        else
+            Abc_Print( 1, "undecided  " );
+        Abc_PrintTime( 1, "Time", ThData[i].clkTotal );
+    }
+    if ( iWinner >= 0 )
+    {
+        Aig_Man_t * pAig = ThData[iWinner].pAig;
+        RetValue = ThData[iWinner].RetValue;
+        if ( RetValue == 1 )
+            Abc_Print( 1, "Property proved by %s.  ", s_PortEngineNames[iWinner] );
+        else
+        {
+            Abc_Print( 1, "Output %d was asserted in frame %d by %s.  ", pAig->pSeqModel->iPo, pAig->pSeqModel->iFrame, s_PortEngineNames[iWinner] );
+            p->pCexSeq = pAig->pSeqModel;
+            pAig->pSeqModel = NULL;
+        }
+        Abc_PrintTime( 1, "Time", ThData[iWinner].clkTotal );
+    }
+    else
+    {
+        Abc_Print( 1, "Property UNDECIDED.  " );
+        Abc_PrintTime( 1, "Time", clkMax );
+    }
+    for ( i = 0; i < CEC_PORT_ENGINES; i++ )
+        Aig_ManStop( ThData[i].pAig );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
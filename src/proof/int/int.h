@@ -63,9 +63,12 @@ struct Inter_ManParams_t_
     int  fUseSeparate;  // solve each output separately
     int  fUseTwoFrames; // create the OR of two last timeframes
     int  fDropSatOuts;  // replace by 1 the solved outputs
+    int  fIncremental;  // reuse the lemmas of the timeframes across iterations
     int  fDropInvar;    // dump inductive invariant into file
     int  fVerbose;      // print verbose statistics
     int  iFrameMax;     // the time frame reached
+    int  RunId;         // interpolation id in this run 
+    int(*pFuncStop)(int); // callback to terminate
     char * pFileName;   // file name to dump interpolant
 };
 
@@ -61,6 +61,7 @@ void Inter_ManSetDefaultParams( Inter_ManParams_t * p )
     p->fUseSeparate  = 0;     // solve each output separately
     p->fUseTwoFrames = 0;     // create OR of two last timeframes
     p->fDropSatOuts  = 0;     // replace by 1 the solved outputs
+    p->fIncremental  = 0;     // reuse the lemmas of the timeframes across iterations
     p->fVerbose      = 0;     // print verbose statistics
     p->iFrameMax     =-1;
 }
@@ -205,6 +206,15 @@ p->timeEqu += Abc_Clock() - clk;
                 Inter_CheckStop( pCheck );
                 return -1;
             }
+            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            {
+                if ( pPars->fVerbose )
+                    printf( "Interpolation was cancelled.\n" );
+                p->timeTotal = Abc_Clock() - clkTotal;
+                Inter_ManStop( p, 0 );
+                Inter_CheckStop( pCheck );
+                return -1;
+            }
 
             // perform interpolation
             clk = Abc_Clock();
@@ -222,6 +232,8 @@ p->timeEqu += Abc_Clock() - clk;
             {
                 printf( "   I = %2d. Bmc =%3d. IntAnd =%6d. IntLev =%5d. Conf =%6d.  ", 
                     i+1, i + 1 + p->nFrames, Aig_ManNodeNum(p->pInter), Aig_ManLevelNum(p->pInter), p->nConfCur );
+                if ( p->vLemmasB )
+                    printf( "Lem =%6d.  ", p->nLemmasB );
                 ABC_PRT( "Time", Abc_Clock() - clk );
             }
             // remember the number of timeframes completed
@@ -242,10 +254,12 @@ p->timeEqu += Abc_Clock() - clk;
                         pParsBmc->nConfLimit = 100000000;
                         pParsBmc->nStart     = p->nFrames;
                         pParsBmc->fVerbose   = pPars->fVerbose;
+                        pParsBmc->RunId      = pPars->RunId;
+                        pParsBmc->pFuncStop  = pPars->pFuncStop;
                         RetValue = Saig_ManBmcScalable( pAig, pParsBmc );
                         if ( RetValue == 1 )
                             printf( "Error: The problem should be SAT but it is UNSAT.\n" );
-                        else if ( RetValue == -1 )
+                        else if ( RetValue == -1 && !(pPars->pFuncStop && pPars->pFuncStop(pPars->RunId)) )
                             printf( "Error: The problem timed out.\n" );
                     }
                     Inter_ManStop( p, 0 );
@@ -264,6 +278,11 @@ p->timeEqu += Abc_Clock() - clk;
                     if ( pPars->fVerbose )
                         printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
                 }
+                else if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) ) // cancelled
+                {
+                    if ( pPars->fVerbose )
+                        printf( "Interpolation was cancelled.\n" );
+                }
                 else
                 {
                     assert( p->nConfCur >= p->nConfLimit );
@@ -64,10 +64,15 @@ struct Inter_Man_t_
     // temporary place for the new interpolant
     Aig_Man_t *      pInterNew;
     Vec_Ptr_t *      vInters;
+    // lemmas of the timeframes reused across iterations
+    Vec_Int_t *      vLemmasB;     // the lemmas (the number of literals followed by literals)
+    int              nLemmasB;     // the number of lemmas
     // parameters
     int              nFrames;      // the number of timeframes
     int              nConfCur;     // the current number of conflicts
     int              nConfLimit;   // the limit on the number of conflicts
+    int              RunId;        // interpolation id in this run 
+    int(*pFuncStop)(int);          // callback to terminate
     int              fVerbose;     // the verbosiness flag
     char *           pFileName;
     // runtime
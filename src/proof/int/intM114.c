@@ -27,6 +27,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define INTER_LEMMA_LITS_MAX 16  // the max number of literals in a reused lemma
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -36,7 +38,8 @@ ABC_NAMESPACE_IMPL_START
   Synopsis    [Returns the SAT solver for one interpolation run.]
 
   Description [pInter is the previous interpolant. pAig is one time frame.
-  pFrames is the unrolled time frames.]
+  pFrames is the unrolled time frames. vLemmasB, if given, contains the 
+  clauses implied by the unrolled time frames, which are added to B.]
                
   SideEffects []
 
@@ -47,11 +50,11 @@ sat_solver * Inter_ManDeriveSatSolver(
     Aig_Man_t * pInter, Cnf_Dat_t * pCnfInter, 
     Aig_Man_t * pAig, Cnf_Dat_t * pCnfAig, 
     Aig_Man_t * pFrames, Cnf_Dat_t * pCnfFrames, 
-    Vec_Int_t * vVarsAB, int fUseBackward )
+    Vec_Int_t * vVarsAB, Vec_Int_t * vLemmasB, int fUseBackward )
 {
     sat_solver * pSat;
     Aig_Obj_t * pObj, * pObj2;
-    int i, Lits[2];
+    int i, Lits[2], * pLemma;
 
 //Aig_ManDumpBlif( pInter,  "out_inter.blif", NULL, NULL );
 //Aig_ManDumpBlif( pAig,    "out_aig.blif", NULL, NULL );
@@ -182,6 +185,19 @@ sat_solver * Inter_ManDeriveSatSolver(
             break;
         }
     }
+    // lemmas of B learned in the previous iterations
+    if ( vLemmasB && !pSat->fSolved )
+    {
+        for ( i = 0; i < Vec_IntSize(vLemmasB); i += pLemma[0] + 1 )
+        {
+            pLemma = Vec_IntEntryP( vLemmasB, i );
+            if ( !sat_solver_addclause( pSat, pLemma + 1, pLemma + 1 + pLemma[0] ) )
+            {
+                pSat->fSolved = 1;
+                break;
+            }
+        }
+    }
     sat_solver_store_mark_roots( pSat );
     // return clauses to the original state
     Cnf_DataLift( pCnfAig, -pCnfFrames->nVars );
@@ -213,7 +229,7 @@ int Inter_ManPerformOneStep( Inter_Man_t * p, int fUseBias, int fUseBackward, ab
 //    assert( p->pInterNew == NULL );
 
     // derive the SAT solver
-    pSat = Inter_ManDeriveSatSolver( p->pInter, p->pCnfInter, p->pAigTrans, p->pCnfAig, p->pFrames, p->pCnfFrames, p->vVarsAB, fUseBackward );
+    pSat = Inter_ManDeriveSatSolver( p->pInter, p->pCnfInter, p->pAigTrans, p->pCnfAig, p->pFrames, p->pCnfFrames, p->vVarsAB, p->vLemmasB, fUseBackward );
     if ( pSat == NULL )
     {
         p->pInterNew = NULL;
@@ -223,6 +239,9 @@ int Inter_ManPerformOneStep( Inter_Man_t * p, int fUseBias, int fUseBackward, ab
     // set runtime limit
     if ( nTimeNewOut )
         sat_solver_set_runtime_limit( pSat, nTimeNewOut );
+    // set the termination callback
+    sat_solver_set_runid( pSat, p->RunId );
+    sat_solver_set_stop_func( pSat, p->pFuncStop );
 
     // collect global variables
     pGlobalVars = ABC_CALLOC( int, sat_solver_nvars(pSat) );
@@ -305,6 +324,9 @@ clk = Abc_Clock();
 
     pManInterA = Inta_ManAlloc();
     p->pInterNew = (Aig_Man_t *)Inta_ManInterpolate( pManInterA, (Sto_Man_t *)pSatCnf, nTimeNewOut, p->vVarsAB, 0 );
+    // save the lemmas implied by the timeframes, as long as they are smaller than the timeframes
+    if ( p->vLemmasB && p->pInterNew && Vec_IntSize(p->vLemmasB) < p->pCnfFrames->nLiterals )
+        p->nLemmasB += Inta_ManCollectLemmasB( pManInterA, p->pInterNew, p->pCnfFrames->nVars, INTER_LEMMA_LITS_MAX, p->vLemmasB );
     Inta_ManFree( pManInterA );
 
 p->timeInt += Abc_Clock() - clk;
@@ -51,11 +51,15 @@ Inter_Man_t * Inter_ManCreate( Aig_Man_t * pAig, Inter_ManParams_t * pPars )
     memset( p, 0, sizeof(Inter_Man_t) );
     p->vVarsAB = Vec_IntAlloc( Aig_ManRegNum(pAig) );
     p->nConfLimit = pPars->nBTLimit;
+    p->RunId = pPars->RunId;
+    p->pFuncStop = pPars->pFuncStop;
     p->fVerbose = pPars->fVerbose;
     p->pFileName = pPars->pFileName;
     p->pAig = pAig;
     if ( pPars->fDropInvar )
         p->vInters = Vec_PtrAlloc( 100 );
+    if ( pPars->fIncremental )
+        p->vLemmasB = Vec_IntAlloc( 1000 );
     return p;
 }
 
@@ -80,6 +84,11 @@ void Inter_ManClean( Inter_Man_t * p )
             Aig_ManStop( pMan );
         Vec_PtrClear( p->vInters );
     }
+    if ( p->vLemmasB )
+    {
+        Vec_IntClear( p->vLemmasB );
+        p->nLemmasB = 0;
+    }
     if ( p->pCnfInter )
         Cnf_DataFree( p->pCnfInter );
     if ( p->pCnfFrames )
@@ -151,6 +160,7 @@ void Inter_ManStop( Inter_Man_t * p, int fProved )
         Aig_ManStop( p->pInterNew );
     Inter_ManClean( p );
     Vec_PtrFreeP( &p->vInters );
+    Vec_IntFreeP( &p->vLemmasB );
     Vec_IntFreeP( &p->vVarsAB );
     ABC_FREE( p );
 }
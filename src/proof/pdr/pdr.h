@@ -50,7 +50,9 @@ struct Pdr_Par_t_
     int nTimeOutGap;      // approximate timeout in seconds since the last change
     int nTimeOutOne;      // approximate timeout in seconds per one output
     int nRandomSeed;      // value to seed the SAT solver with
+    int nProcs;           // the number of concurrent workers
     int fTwoRounds;       // use two rounds for generalization
+    int fBatchGen;        // drop groups of literals in generalization
     int fMonoCnf;         // monolythic CNF
     int fNewXSim;         // updated X-valued simulation
     int fFlopPrio;        // use structural flop priorities
@@ -59,7 +59,9 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nProcs         =       1;  // the number of concurrent workers
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
+    pPars->fBatchGen      =       0;  // drop groups of literals in generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
     pPars->fFlopPrio      =       0;  // use structural flop priorities
@@ -667,6 +669,151 @@ int Pdr_ManGeneralize2( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** pp
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Generalizes the cube by dropping groups of literals.]
+
+  Description [The literals are tried in the order of increasing priority.
+  Instead of one SAT call per literal, a group of literals is dropped at
+  once. If the remaining cube is still inductive relative to frame k,
+  the whole group is dropped by one SAT call, and the UNSAT core is used
+  to drop more literals. Otherwise, the witness successor is simulated to
+  find the literals of the group it violates. The witness refutes dropping
+  any subset of the group containing all of them, so the rest of the group
+  is tried next, and a single violated literal is kept without a call of
+  its own. Takes the ownership of the cube. Returns the generalized cube,
+  or NULL if a resource limit is reached.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_Set_t * Pdr_ManGeneralizeBatch( Pdr_Man_t * p, int k, Pdr_Set_t * pCubeMin )
+{
+    Pdr_Set_t * pCubeTry, * pCubeTmp;
+    Vec_Int_t * vCands = Vec_IntAlloc( pCubeMin->nLits ); // candidates (the last one is tried first)
+    Vec_Int_t * vGroup = Vec_IntAlloc( pCubeMin->nLits ); // literals dropped together
+    Vec_Int_t * vRest  = Vec_IntAlloc( pCubeMin->nLits ); // literals remaining in the cube
+    Vec_Int_t * vViol  = Vec_IntAlloc( pCubeMin->nLits ); // literals violated by the witness
+    Vec_Int_t * vVals  = Vec_IntAlloc( pCubeMin->nLits ); // next-state values of the literals
+    int * pOrder = Pdr_ManSortByPriority( p, pCubeMin );
+    int i, Lit, fHasPos, nGroup, RetValue = 1;
+    for ( i = pCubeMin->nLits - 1; i >= 0; i-- )
+        Vec_IntPush( vCands, pCubeMin->Lits[pOrder[i]] );
+    nGroup = Abc_MaxInt( 1, Vec_IntSize(vCands) / 2 );
+    while ( Vec_IntSize(vCands) > 0 )
+    {
+        // collect the next group among the literals still in the cube
+        Vec_IntClear( vGroup );
+        while ( Vec_IntSize(vGroup) < nGroup && Vec_IntSize(vCands) > 0 )
+        {
+            Lit = Vec_IntPop( vCands );
+            for ( i = 0; i < pCubeMin->nLits; i++ )
+                if ( pCubeMin->Lits[i] == Lit )
+                    break;
+            if ( i < pCubeMin->nLits )
+                Vec_IntPush( vGroup, Lit );
+        }
+        if ( Vec_IntSize(vGroup) == 0 )
+            break;
+        // collect the remaining literals
+        Vec_IntClear( vRest );
+        fHasPos = 0;
+        for ( i = 0; i < pCubeMin->nLits; i++ )
+            if ( Vec_IntFind(vGroup, pCubeMin->Lits[i]) == -1 )
+            {
+                Vec_IntPush( vRest, pCubeMin->Lits[i] );
+                fHasPos |= !Abc_LitIsCompl( pCubeMin->Lits[i] );
+            }
+        // check init state
+        if ( !fHasPos )
+        {
+            if ( Vec_IntSize(vGroup) == 1 ) // the literal is kept
+                continue;
+            Vec_IntForEachEntryReverse( vGroup, Lit, i )
+                Vec_IntPush( vCands, Lit );
+            nGroup = Vec_IntSize(vGroup) / 2;
+            continue;
+        }
+        // make sure the cones of the group are in the solver for simulation
+        if ( Vec_IntSize(vGroup) > 1 && !p->pPars->nConfGenLimit )
+            Pdr_ManCubeToLits( p, k, pCubeMin, 0, 1 );
+        // try removing the group
+        pCubeTry = Pdr_SetCreateSubset( pCubeMin, Vec_IntArray(vRest), Vec_IntSize(vRest) );
+        RetValue = Pdr_ManCheckCube( p, k, pCubeTry, NULL, p->pPars->nConfLimit, 1, 1 );
+        p->nGenCalls++;
+        if ( RetValue == -1 )
+        {
+            Pdr_SetDeref( pCubeTry );
+            break;
+        }
+        if ( RetValue == 1 )
+        {
+            // success - drop the group and the literals outside of the UNSAT core
+            pCubeTmp = Pdr_ManReduceClause( p, k, pCubeTry );
+            if ( pCubeTmp )
+            {
+                Pdr_SetDeref( pCubeTry );
+                pCubeTry = pCubeTmp;
+            }
+            p->nGenSaved += pCubeMin->nLits - pCubeTry->nLits - 1;
+            Pdr_SetDeref( pCubeMin );
+            pCubeMin = pCubeTry;
+            continue;
+        }
+        Pdr_SetDeref( pCubeTry );
+        if ( Vec_IntSize(vGroup) == 1 ) // the literal is kept
+            continue;
+        // find the literals of the group violated by the witness successor
+        Vec_IntClear( vViol );
+        if ( !p->pPars->nConfGenLimit ) // otherwise, there may be no witness
+        {
+            Pdr_ManTernaryEvalCube( p, k, pCubeMin, vVals );
+            Vec_IntForEachEntry( vVals, Lit, i )
+                if ( !Lit )
+                {
+                    assert( Vec_IntFind(vGroup, pCubeMin->Lits[i]) >= 0 );
+                    Vec_IntPush( vViol, pCubeMin->Lits[i] );
+                }
+        }
+        if ( Vec_IntSize(vViol) == 1 ) // the violated literal is kept
+        {
+            p->nGenSaved++;
+            Vec_IntRemove( vGroup, Vec_IntEntry(vViol, 0) );
+            Vec_IntForEachEntryReverse( vGroup, Lit, i )
+                Vec_IntPush( vCands, Lit );
+            nGroup = Vec_IntSize(vGroup);
+        }
+        else if ( Vec_IntSize(vViol) > 1 && Vec_IntSize(vViol) < Vec_IntSize(vGroup) ) // try the rest of the group first
+        {
+            Vec_IntForEachEntryReverse( vViol, Lit, i )
+                Vec_IntPush( vCands, Lit );
+            Vec_IntForEachEntryReverse( vGroup, Lit, i )
+                if ( Vec_IntFind(vViol, Lit) == -1 )
+                    Vec_IntPush( vCands, Lit );
+            nGroup = Vec_IntSize(vGroup) - Vec_IntSize(vViol);
+        }
+        else // split the group
+        {
+            Vec_IntForEachEntryReverse( vGroup, Lit, i )
+                Vec_IntPush( vCands, Lit );
+            nGroup = Vec_IntSize(vGroup) / 2;
+        }
+    }
+    Vec_IntFree( vCands );
+    Vec_IntFree( vGroup );
+    Vec_IntFree( vRest );
+    Vec_IntFree( vViol );
+    Vec_IntFree( vVals );
+    if ( RetValue == -1 )
+    {
+        Pdr_SetDeref( pCubeMin );
+        return NULL;
+    }
+    return pCubeMin;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns 1 if the state could be blocked.]
@@ -745,9 +892,20 @@ int Pdr_ManGeneralize( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppP
             sat_solver_compress( pSat );
         }
 
+        // try removing groups of literals
+        if ( p->pPars->fBatchGen )
+        {
+            pCubeMin = Pdr_ManGeneralizeBatch( p, k, pCubeMin );
+            if ( pCubeMin == NULL )
+            {
+                if ( keep ) Hash_IntFree( keep );
+                return -1;
+            }
+        }
         // sort literals by their occurences
         pOrder = Pdr_ManSortByPriority( p, pCubeMin );
         // try removing literals
+        if ( !p->pPars->fBatchGen )
         for ( j = 0; j < pCubeMin->nLits; j++ )
         {
             // use ordering
@@ -903,6 +1061,9 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
 //    assert( p->pQueue == NULL );
     pThis = Pdr_OblStart( kMax, Prio--, pCube, NULL ); // consume ref
     Pdr_QueuePush( p, pThis );
+    // add the clauses derived by other workers
+    if ( p->pSto && Pdr_StoImport( p ) == -1 )
+        return -1;
     // try to solve it recursively
     while ( !Pdr_QueueIsEmpty(p) )
     {
@@ -991,6 +1152,9 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             // add clause
             for ( i = 1; i <= k; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
+            // share clause with other workers
+            if ( p->pSto )
+                Pdr_StoExport( p, k, pCubeMin );
             // schedule proof obligation
             if ( (k < kMax || p->pPars->fReuseProofOblig) && !p->pPars->fShortest )
             {
@@ -1016,6 +1180,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
         // check termination
         if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
             return -1;
+        if ( p->pSto && Pdr_StoIsStopped(p->pSto) )
+            return -1;
         if ( p->timeToStop && Abc_Clock() > p->timeToStop )
             return -1;
         if ( p->timeToStopOne && Abc_Clock() > p->timeToStopOne )
@@ -1161,7 +1327,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                     }
                     else if ( p->pPars->nConfLimit )
                         Abc_Print( 1, "Reached conflict limit (%d) in frame %d.\n",  p->pPars->nConfLimit, iFrame );
-                    else if ( p->pPars->fVerbose )
+                    else if ( p->pPars->fVerbose && !p->pPars->fSilent ) // silent workers are stopped when another one finishes
                         Abc_Print( 1, "Computation cancelled by the callback in frame %d.\n", iFrame );
                     p->pPars->iFrame = iFrame;
                     return -1;
@@ -1185,7 +1351,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                         }
                         else if ( p->pPars->nConfLimit )
                             Abc_Print( 1, "Reached conflict limit (%d) in frame %d.\n",  p->pPars->nConfLimit, iFrame );
-                        else if ( p->pPars->fVerbose )
+                        else if ( p->pPars->fVerbose && !p->pPars->fSilent )
                             Abc_Print( 1, "Computation cancelled by the callback in frame %d.\n", iFrame );
                         p->pPars->iFrame = iFrame;
                         return -1;
@@ -1287,7 +1453,10 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             Pdr_ManPrintClauses( p, 0 );
         }
         // push clauses into this timeframe
-        RetValue = Pdr_ManPushClauses( p );
+        if ( p->pSto && Pdr_StoImport( p ) == -1 )
+            RetValue = -1;
+        else
+            RetValue = Pdr_ManPushClauses( p );
         if ( RetValue == -1 )
         {
             if ( p->pPars->fVerbose )
@@ -1332,7 +1501,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             Pdr_ManPrintProgress( p, 0, Abc_Clock() - clkStart );
 
         // check termination
-        if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
+        if ( (p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId)) || (p->pSto && Pdr_StoIsStopped(p->pSto)) )
         {
             p->pPars->iFrame = iFrame;
             return -1;
@@ -1393,6 +1562,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
 int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
 {
     Pdr_Man_t * p;
+    Aig_Man_t * pAigCopy = NULL;
     int k, RetValue;
     abctime clk = Abc_Clock();
     if ( pPars->nTimeOutOne && !pPars->fSolveAll )
@@ -1413,8 +1583,18 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSolveAll ?    "yes" : "no" );
     }
     ABC_FREE( pAig->pSeqModel );
-    p = Pdr_ManStart( pAig, pPars, NULL );
-    RetValue = Pdr_ManSolveInt( p );
+    if ( pPars->nProcs > 1 && pPars->fSolveAll && !pPars->fUseAbs )
+        return Pdr_ManSolveParAll( pAig, pPars );
+    if ( pPars->nProcs > 1 && !pPars->fSolveAll && !pPars->fUseAbs )
+    {
+        p = Pdr_ManSolvePar( pAig, pPars, &RetValue );
+        pAigCopy = p->pAig;
+    }
+    else
+    {
+        p = Pdr_ManStart( pAig, pPars, NULL );
+        RetValue = Pdr_ManSolveInt( p );
+    }
     if ( RetValue == 0 )
         assert( pAig->pSeqModel != NULL || p->vCexes != NULL );
     if ( p->vCexes )
@@ -1434,6 +1614,8 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
         Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
     p->tTotal += Abc_Clock() - clk;
     Pdr_ManStop( p );
+    if ( pAigCopy )
+        Aig_ManStop( pAigCopy );
     pPars->iFrame--;
     // convert all -2 (unknown) entries into -1 (undec)
     if ( pPars->vOutMap )
@@ -545,7 +545,7 @@ int IPdr_ManSolveInt( Pdr_Man_t * p, int fCheckClauses, int fPushClauses )
                     }
                     else if ( p->pPars->nConfLimit )
                         Abc_Print( 1, "Reached conflict limit (%d) in frame %d.\n",  p->pPars->nConfLimit, iFrame );
-                    else if ( p->pPars->fVerbose )
+                    else if ( p->pPars->fVerbose && !p->pPars->fSilent )
                         Abc_Print( 1, "Computation cancelled by the callback in frame %d.\n", iFrame );
                     p->pPars->iFrame = iFrame;
                     return -1;
@@ -569,7 +569,7 @@ int IPdr_ManSolveInt( Pdr_Man_t * p, int fCheckClauses, int fPushClauses )
                         }
                         else if ( p->pPars->nConfLimit )
                             Abc_Print( 1, "Reached conflict limit (%d) in frame %d.\n",  p->pPars->nConfLimit, iFrame );
-                        else if ( p->pPars->fVerbose )
+                        else if ( p->pPars->fVerbose && !p->pPars->fSilent )
                             Abc_Print( 1, "Computation cancelled by the callback in frame %d.\n", iFrame );
                         p->pPars->iFrame = iFrame;
                         return -1;
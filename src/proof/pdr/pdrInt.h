@@ -70,6 +70,7 @@ ABC_NAMESPACE_HEADER_START
 
 typedef struct Txs_Man_t_  Txs_Man_t;
 typedef struct Txs3_Man_t_ Txs3_Man_t;
+typedef struct Pdr_Sto_t_  Pdr_Sto_t;
 
 typedef struct Pdr_Set_t_ Pdr_Set_t;
 struct Pdr_Set_t_
@@ -140,6 +141,12 @@ struct Pdr_Man_t_
     Vec_Int_t * vRes;      // final result
     abctime *   pTime4Outs;// timeout per output
     Vec_Ptr_t * vInfCubes; // infinity clauses/cubes
+    // concurrent solving
+    Pdr_Sto_t * pSto;      // the clause store shared by the workers
+    int         iWorker;   // the index of this worker
+    int         iStoNext;  // the next clause of the store to import
+    int         nExported; // the number of clauses given to the store
+    int         nImported; // the number of clauses taken from the store
     // statistics
     int         nBlocks;   // the number of times blockState was called
     int         nObligs;   // the number of proof obligations derived
@@ -158,6 +165,8 @@ struct Pdr_Man_t_
     int         nQueLim;
     int         nXsimRuns;
     int         nXsimLits;
+    int         nGenCalls; // the number of SAT calls in batched generalization
+    int         nGenSaved; // the number of SAT calls saved by batched generalization
     // runtime
     abctime     timeToStop;
     abctime     timeToStopOne;
@@ -202,6 +211,7 @@ extern int             Pdr_ManFreeVar( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManNewSolver( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit );
 /*=== pdrCore.c ==========================================================*/
 extern int             Pdr_ManCheckContainment( Pdr_Man_t * p, int k, Pdr_Set_t * pSet );
+extern int             Pdr_ManSolveInt( Pdr_Man_t * p );
 /*=== pdrInv.c ==========================================================*/
 extern Vec_Int_t *     Pdr_ManCountFlopsInv( Pdr_Man_t * p );
 extern void            Pdr_ManPrintProgress( Pdr_Man_t * p, int fClose, abctime Time );
@@ -211,11 +221,18 @@ extern Vec_Str_t *     Pdr_ManDumpString( Pdr_Man_t * p );
 extern void            Pdr_ManReportInvariant( Pdr_Man_t * p );
 extern void            Pdr_ManVerifyInvariant( Pdr_Man_t * p );
 extern Vec_Int_t *     Pdr_ManDeriveInfinityClauses( Pdr_Man_t * p, int fReduce );
+extern Vec_Ptr_t *     Pdr_ManDeriveInductiveCubes( Pdr_Man_t * p );
 /*=== pdrMan.c ==========================================================*/
 extern Pdr_Man_t *     Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrioInit );
 extern void            Pdr_ManStop( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCex( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCexAbs( Pdr_Man_t * p );
+/*=== pdrPar.c ==========================================================*/
+extern int             Pdr_StoIsStopped( Pdr_Sto_t * p );
+extern void            Pdr_StoExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube );
+extern int             Pdr_StoImport( Pdr_Man_t * p );
+extern Pdr_Man_t *     Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars, int * pRetValue );
+extern int             Pdr_ManSolveParAll( Aig_Man_t * pAig, Pdr_Par_t * pPars );
 /*=== pdrSat.c ==========================================================*/
 extern sat_solver *    Pdr_ManCreateSolver( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManFetchSolver( Pdr_Man_t * p, int k );
@@ -228,6 +245,7 @@ extern int             Pdr_ManCheckCubeCs( Pdr_Man_t * p, int k, Pdr_Set_t * pCu
 extern int             Pdr_ManCheckCube( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppPred, int nConfLimit, int fTryConf, int fUseLit );
 /*=== pdrTsim.c ==========================================================*/
 extern Pdr_Set_t *     Pdr_ManTernarySim( Pdr_Man_t * p, int k, Pdr_Set_t * pCube );
+extern void            Pdr_ManTernaryEvalCube( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Vec_Int_t * vValues );
 /*=== pdrTsim2.c ==========================================================*/
 extern Txs_Man_t *     Txs_ManStart( Pdr_Man_t * pMan, Aig_Man_t * pAig, Vec_Int_t * vPrio );
 extern void            Txs_ManStop( Txs_Man_t * );
@@ -623,6 +623,40 @@ Vec_Int_t * Pdr_ManDeriveInfinityClauses( Pdr_Man_t * p, int fReduce )
     return vResult;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives the inductive subset of the invariant clauses.]
+
+  Description [Returns copies of the cubes of the invariant, from which
+  the cubes whose clauses are not inductive without the property are
+  iteratively removed. The remaining clauses hold in all reachable states
+  and can be used as lemmas when checking other properties of the same
+  design. The clauses of the manager are not modified.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Pdr_ManDeriveInductiveCubes( Pdr_Man_t * p )
+{
+    Vec_Ptr_t * vCubes, * vResult;
+    Pdr_Set_t * pCube;
+    int i;
+    vCubes = Pdr_ManCollectCubes( p, Pdr_ManFindInvariantStart(p) );
+    Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+        Vec_PtrWriteEntry( vCubes, i, Pdr_SetDup(pCube) );
+    while ( Pdr_ManDeriveMarkNonInductive(p, vCubes) );
+    vResult = Vec_PtrAlloc( Vec_PtrSize(vCubes) );
+    Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+        if ( pCube->nRefs == -1 ) // skip non-inductive
+            ABC_FREE( pCube );
+        else
+            Vec_PtrPush( vResult, pCube );
+    Vec_PtrFree( vCubes );
+    return vResult;
+}
+
 
 
 /**Function*************************************************************
@@ -326,6 +326,8 @@ void Pdr_ManStop( Pdr_Man_t * p )
     {
         Abc_Print( 1, "Block =%5d  Oblig =%6d  Clause =%6d  Call =%6d (sat=%.1f%%)  Cex =%4d  Start =%4d\n", 
             p->nBlocks, p->nObligs, p->nCubes, p->nCalls, 100.0 * p->nCallsS / p->nCalls, p->nCexesTotal, p->nStarts );
+        if ( p->pPars->fBatchGen )
+            Abc_Print( 1, "Batched generalization:  Call =%6d  Saved =%6d\n", p->nGenCalls, p->nGenSaved );
         ABC_PRTP( "SAT solving", p->tSat,       p->tTotal );
         ABC_PRTP( "  unsat    ", p->tSatUnsat,  p->tTotal );
         ABC_PRTP( "  sat      ", p->tSatSat,    p->tTotal );
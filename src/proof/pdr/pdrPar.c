@@ -0,0 +1,639 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Concurrent PDR with shared frame clauses.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - November 20, 2010.]
+
+  Revision    [$Id: pdrPar.c,v 1.00 2010/11/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define PDR_THR_MAX    100   // the max number of threads
+
+extern int Gia_ManToBridgeResult( FILE * pFile, int Result, Abc_Cex_t * pCex, int iPoProved );
+extern int Gia_ManToBridgeAbort( FILE * pFile, int Size, unsigned char * pBuffer );
+
+struct Pdr_Sto_t_
+{
+    Vec_Ptr_t *       vCubes;      // shared clauses (as cubes of blocked states)
+    Vec_Int_t *       vFrames;     // the frame where each clause was derived
+    Vec_Int_t *       vOwners;     // the worker that derived each clause
+    volatile int      fStop;       // set when one of the workers solved the problem
+    int               iWinner;     // the worker that solved the problem
+    int               fLemmasOnly; // share only the invariants of proved outputs
+    abctime           timeToStop;  // the wall-clock deadline of all workers (0 if none)
+};
+
+typedef struct Pdr_All_t_ Pdr_All_t;
+struct Pdr_All_t_
+{
+    Aig_Man_t *       pAig;        // the multi-output AIG
+    Pdr_Par_t *       pPars;       // the parameters of the user
+    Pdr_Sto_t *       pSto;        // the lemmas shared by the outputs
+    Vec_Ptr_t *       vCexes;      // the counter-examples by output
+    int               iNext;       // the next output to solve
+    int               nOutDigits;  // the number of digits in the output number
+    int               iFrameMax;   // the largest frame reached
+    abctime           clkStart;    // the starting time (wall clock)
+};
+
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_PdrParMutex = PTHREAD_MUTEX_INITIALIZER;
+static inline void Pdr_StoLock()   { int status = pthread_mutex_lock( &s_PdrParMutex );    assert( status == 0 ); (void)status; }
+static inline void Pdr_StoUnlock() { int status = pthread_mutex_unlock( &s_PdrParMutex );  assert( status == 0 ); (void)status; }
+#else
+static inline void Pdr_StoLock()   {}
+static inline void Pdr_StoUnlock() {}
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the shared clause store.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_Sto_t * Pdr_StoStart()
+{
+    Pdr_Sto_t * p = ABC_CALLOC( Pdr_Sto_t, 1 );
+    p->vCubes  = Vec_PtrAlloc( 1000 );
+    p->vFrames = Vec_IntAlloc( 1000 );
+    p->vOwners = Vec_IntAlloc( 1000 );
+    p->iWinner = -1;
+    return p;
+}
+void Pdr_StoStop( Pdr_Sto_t * p )
+{
+    Pdr_Set_t * pCube; int i;
+    Vec_PtrForEachEntry( Pdr_Set_t *, p->vCubes, pCube, i )
+        Pdr_SetDeref( pCube );
+    Vec_PtrFree( p->vCubes );
+    Vec_IntFree( p->vFrames );
+    Vec_IntFree( p->vOwners );
+    ABC_FREE( p );
+}
+int Pdr_StoIsStopped( Pdr_Sto_t * p )
+{
+    return p->fStop || (p->timeToStop && Abc_ClockWall() > p->timeToStop);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes a clause derived by the worker in frame k.]
+
+  Description [The store keeps its own copy, because the reference
+  counters of the cubes are not thread-safe.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_StoExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Set_t * pCopy;
+    if ( p->pSto->fLemmasOnly )
+        return;
+    pCopy = Pdr_SetDup( pCube );
+    Pdr_StoLock();
+    Vec_PtrPush( p->pSto->vCubes, pCopy );
+    Vec_IntPush( p->pSto->vFrames, k );
+    Vec_IntPush( p->pSto->vOwners, p->iWorker );
+    Pdr_StoUnlock();
+    p->nExported++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses published by other workers.]
+
+  Description [A clause derived by another worker in frame k blocks
+  states unreachable in k steps, but it is not necessarily inductive
+  relative to the frames of this worker. Before it is added to frame k,
+  it is checked by one SAT call against frame k-1 of this worker, which
+  keeps the frames a valid sequence of relatively inductive clauses.
+  Clauses failing the check, or already implied, are dropped. Clauses
+  published with frame -1 are inductive invariants of other properties;
+  they hold in all reachable states and are added to the last frame
+  without the check. Returns -1 if a resource limit is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_StoImport( Pdr_Man_t * p )
+{
+    Vec_Ptr_t * vCubes = NULL;
+    Vec_Int_t * vFrames = NULL;
+    Pdr_Set_t * pCube;
+    int i, j, k, kMax = Vec_PtrSize(p->vSolvers)-1, iStop, RetValue = 0;
+    if ( kMax < 1 )
+        return 0;
+    // collect the new clauses of other workers
+    Pdr_StoLock();
+    iStop = Vec_PtrSize( p->pSto->vCubes );
+    if ( p->iStoNext < iStop )
+    {
+        vCubes  = Vec_PtrAlloc( iStop - p->iStoNext );
+        vFrames = Vec_IntAlloc( iStop - p->iStoNext );
+        for ( i = p->iStoNext; i < iStop; i++ )
+        {
+            if ( Vec_IntEntry(p->pSto->vOwners, i) == p->iWorker )
+                continue;
+            Vec_PtrPush( vCubes, Pdr_SetDup((Pdr_Set_t *)Vec_PtrEntry(p->pSto->vCubes, i)) );
+            Vec_IntPush( vFrames, Vec_IntEntry(p->pSto->vFrames, i) );
+        }
+    }
+    p->iStoNext = iStop;
+    Pdr_StoUnlock();
+    if ( vCubes == NULL )
+        return 0;
+    // add them to the frames of this worker
+    Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+    {
+        int Status = 0;
+        int fLemma = (Vec_IntEntry(vFrames, i) == -1);
+        k = fLemma ? kMax : Abc_MinInt( Vec_IntEntry(vFrames, i), kMax );
+        if ( RetValue != -1 && k >= 1 && !Pdr_ManCheckContainment(p, k, pCube) )
+            Status = fLemma ? 1 : Pdr_ManCheckCube( p, k-1, pCube, NULL, p->pPars->nConfLimit, 0, 1 );
+        if ( Status == -1 )
+            RetValue = -1;
+        if ( Status != 1 )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        for ( j = 1; j <= k; j++ )
+            Pdr_ManSolverAddClause( p, j, pCube );
+        Vec_VecPush( p->vClauses, k, pCube ); // consume ref
+        p->nImported++;
+    }
+    Vec_PtrFree( vCubes );
+    Vec_IntFree( vFrames );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolveWorker( Pdr_Man_t * p )
+{
+    int RetValue = Pdr_ManSolveInt( p );
+    if ( RetValue != -1 )
+    {
+        Pdr_StoLock();
+        if ( !p->pSto->fStop )
+        {
+            p->pSto->iWinner = p->iWorker;
+            p->pSto->fStop = 1;
+        }
+        Pdr_StoUnlock();
+    }
+    return RetValue;
+}
+
+#ifndef ABC_USE_PTHREADS
+
+void Pdr_ManSolveWorkers( Pdr_Man_t ** pMans, int * pRetValues, int nProcs )
+{
+    // without threads, only the first worker is run
+    pRetValues[0] = Pdr_ManSolveWorker( pMans[0] );
+}
+
+#else // pthreads are used
+
+typedef struct Pdr_ThData_t_
+{
+    Pdr_Man_t *       pMan;        // the worker
+    int               RetValue;    // the result of the worker
+} Pdr_ThData_t;
+
+void * Pdr_ManWorkerThread( void * pArg )
+{
+    Pdr_ThData_t * pThData = (Pdr_ThData_t *)pArg;
+    pThData->RetValue = Pdr_ManSolveWorker( pThData->pMan );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+void Pdr_ManSolveWorkers( Pdr_Man_t ** pMans, int * pRetValues, int nProcs )
+{
+    pthread_t WorkerThread[PDR_THR_MAX];
+    Pdr_ThData_t ThData[PDR_THR_MAX];
+    int i, status;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pMan     = pMans[i];
+        ThData[i].RetValue = -1;
+        status = pthread_create( WorkerThread + i, NULL, Pdr_ManWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        pRetValues[i] = ThData[i].RetValue;
+    }
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the property using several cooperating workers.]
+
+  Description [Each worker runs PDR on its own copy of the AIG with
+  different SAT solver seeds and generalization settings, so that the
+  workers block different proof obligations. Clauses learned by one
+  worker are shared through the store and validated by the others before
+  being added to their frames, where they also take part in clause
+  pushing. The first worker that proves or disproves the property stops
+  the rest. Returns the manager of the deciding worker (or of the first
+  worker, if none decided) with the parameters of the user restored;
+  its AIG is a copy that the caller should free after stopping the
+  manager. If a counter-example is found, it is stored in pAig.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_Man_t * Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars, int * pRetValue )
+{
+    Pdr_Man_t * pMans[PDR_THR_MAX], * p;
+    Pdr_Par_t * pParsAll;
+    int pRetValues[PDR_THR_MAX];
+    int i, iWinner, nProcs = Abc_MinInt( pPars->nProcs, PDR_THR_MAX );
+    Pdr_Sto_t * pSto = Pdr_StoStart();
+    assert( !pPars->fSolveAll && !pPars->fUseAbs );
+    pParsAll = ABC_ALLOC( Pdr_Par_t, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pParsAll[i] = *pPars;
+        pParsAll[i].nProcs       = 1;
+        pParsAll[i].nRandomSeed  = pPars->nRandomSeed + 7919 * i;
+        pParsAll[i].fFlopOrder  ^= (i & 1);
+        pParsAll[i].fSkipDown   ^= ((i >> 1) & 1);
+        pParsAll[i].fVerbose     = i ? 0 : pPars->fVerbose;
+        pParsAll[i].fVeryVerbose = 0;
+        pParsAll[i].fNotVerbose  = 1;
+        pParsAll[i].fSilent      = 1;
+        pParsAll[i].fDumpInv     = 0;
+        pMans[i] = Pdr_ManStart( Aig_ManDupSimple(pAig), pParsAll + i, NULL );
+        pMans[i]->pSto    = pSto;
+        pMans[i]->iWorker = i;
+        pRetValues[i]     = -1;
+    }
+    Pdr_ManSolveWorkers( pMans, pRetValues, nProcs );
+    iWinner = pSto->fStop ? pSto->iWinner : 0;
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Workers = %d. Shared clauses = %d. ", nProcs, Vec_PtrSize(pSto->vCubes) );
+        if ( pSto->fStop )
+            Abc_Print( 1, "Decided by worker %d (imported %d clauses).\n", iWinner, pMans[iWinner]->nImported );
+        else
+            Abc_Print( 1, "Undecided.\n" );
+    }
+    // return the results of the deciding worker
+    p = pMans[iWinner];
+    *pRetValue = pRetValues[iWinner];
+    pPars->iFrame         = p->pPars->iFrame;
+    pPars->nFailOuts      = p->pPars->nFailOuts;
+    pPars->nDropOuts      = p->pPars->nDropOuts;
+    pPars->nProveOuts     = p->pPars->nProveOuts;
+    pPars->timeLastSolved = p->pPars->timeLastSolved;
+    p->pPars = pPars;
+    if ( p->pAig->pSeqModel )
+    {
+        pAig->pSeqModel = p->pAig->pSeqModel;
+        p->pAig->pSeqModel = NULL;
+    }
+    if ( *pRetValue == 1 && !pPars->fSilent )
+    {
+        Pdr_ManReportInvariant( p );
+        Pdr_ManVerifyInvariant( p );
+    }
+    // stop the other workers
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Aig_Man_t * pAigCopy = pMans[i]->pAig;
+        if ( i == iWinner )
+            continue;
+        pMans[i]->pPars->fVerbose = 0;
+        Pdr_ManStop( pMans[i] );
+        Aig_ManStop( pAigCopy );
+    }
+    p->pSto = NULL;
+    Pdr_StoStop( pSto );
+    ABC_FREE( pParsAll );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the result of one output.]
+
+  Description [Called by the workers as soon as an output is decided, so
+  that the statuses are reported in the order in which they are found.
+  The invariant of a proved output is published as lemmas for the
+  outputs solved later.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManReportOutput( Pdr_All_t * p, int iOut, int RetValue, int iFrame, Abc_Cex_t * pCex, Vec_Ptr_t * vLemmas )
+{
+    Pdr_Par_t * pPars = p->pPars;
+    Pdr_Set_t * pCube;
+    int i, nPos = Saig_ManPoNum(p->pAig);
+    Pdr_StoLock();
+    p->iFrameMax = Abc_MaxInt( p->iFrameMax, iFrame );
+    if ( RetValue == 1 )
+    {
+        Vec_PtrForEachEntry( Pdr_Set_t *, vLemmas, pCube, i )
+        {
+            Vec_PtrPush( p->pSto->vCubes, pCube );
+            Vec_IntPush( p->pSto->vFrames, -1 );
+            Vec_IntPush( p->pSto->vOwners, -1 );
+        }
+        pPars->nProveOuts++;
+        Vec_IntWriteEntry( pPars->vOutMap, iOut, 1 ); // unsat
+        if ( pPars->fUseBridge )
+            Gia_ManToBridgeResult( stdout, 1, NULL, iOut );
+        if ( !pPars->fNotVerbose )
+            Abc_Print( 1, "Output %*d was proved in frame %2d with %d lemmas (solved %*d out of %*d outputs).\n",
+                p->nOutDigits, iOut, iFrame, Vec_PtrSize(vLemmas), p->nOutDigits, pPars->nFailOuts + pPars->nProveOuts, p->nOutDigits, nPos );
+    }
+    else if ( RetValue == 0 )
+    {
+        assert( pCex != NULL );
+        pCex->iPo = iOut;
+        pPars->nFailOuts++;
+        pPars->timeLastSolved = Abc_ClockWall();
+        Vec_IntWriteEntry( pPars->vOutMap, iOut, 0 ); // sat
+        if ( pPars->fUseBridge )
+            Gia_ManToBridgeResult( stdout, 0, pCex, pCex->iPo );
+        if ( !pPars->fUseBridge && !pPars->fStoreCex )
+        {
+            Abc_CexFree( pCex );
+            pCex = (Abc_Cex_t *)(ABC_PTRINT_T)1;
+        }
+        Vec_PtrWriteEntry( p->vCexes, iOut, pCex );
+        if ( pPars->pFuncOnFail && pPars->pFuncOnFail(iOut, pPars->fStoreCex ? pCex : NULL) )
+        {
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Quitting due to callback on fail in frame %d.\n", iFrame );
+            p->pSto->fStop = 1;
+        }
+        if ( !pPars->fNotVerbose )
+            Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",
+                p->nOutDigits, iOut, iFrame, p->nOutDigits, pPars->nFailOuts + pPars->nProveOuts, p->nOutDigits, nPos );
+    }
+    Pdr_StoUnlock();
+    if ( vLemmas )
+        Vec_PtrFree( vLemmas );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one output of the multi-output AIG.]
+
+  Description [The output is solved by the regular PDR engine on the
+  single-output copy of the AIG, which keeps all flops, so that the
+  lemmas are expressed over the same flops for all outputs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManSolveOutput( Pdr_All_t * p, int iOut, Aig_Man_t * pAigOne )
+{
+    Pdr_Par_t Pars, * pPars = &Pars;
+    Pdr_Man_t * pMan;
+    Vec_Ptr_t * vLemmas = NULL;
+    Abc_Cex_t * pCex = NULL;
+    int RetValue, nTimeLeft = 0;
+    if ( p->pPars->nTimeOut )
+    {
+        nTimeLeft = p->pPars->nTimeOut - (int)((Abc_ClockWall() - p->clkStart) / CLOCKS_PER_SEC);
+        if ( nTimeLeft <= 0 )
+            return;
+    }
+    *pPars = *p->pPars;
+    pPars->fSolveAll    = 0;
+    pPars->nProcs       = 1;
+    pPars->fVerbose     = 0;
+    pPars->fVeryVerbose = 0;
+    pPars->fNotVerbose  = 1;
+    pPars->fSilent      = 1;
+    pPars->fDumpInv     = 0;
+    pPars->fUseBridge   = 0;
+    pPars->vOutMap      = NULL;
+    pPars->pFuncOnFail  = NULL;
+    pPars->nTimeOutGap  = 0;
+    pPars->nTimeOutOne  = 0;
+    pPars->nTimeOut     = nTimeLeft;
+    if ( p->pPars->nTimeOutOne )
+    {
+        int nTimeOne = (p->pPars->nTimeOutOne + 999) / 1000;
+        pPars->nTimeOut = nTimeLeft ? Abc_MinInt( nTimeLeft, nTimeOne ) : nTimeOne;
+    }
+    pMan = Pdr_ManStart( pAigOne, pPars, NULL );
+    pMan->pSto    = p->pSto;
+    pMan->iWorker = iOut;
+    RetValue = Pdr_ManSolveInt( pMan );
+    if ( RetValue == 1 )
+        vLemmas = Pdr_ManDeriveInductiveCubes( pMan );
+    else if ( RetValue == 0 )
+    {
+        pCex = pAigOne->pSeqModel;
+        pAigOne->pSeqModel = NULL;
+    }
+    pMan->pSto = NULL;
+    Pdr_ManStop( pMan );
+    Pdr_ManReportOutput( p, iOut, RetValue, pPars->iFrame, pCex, vLemmas );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs taken from the shared queue.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManSolveOutputs( Pdr_All_t * p )
+{
+    Aig_Man_t * pAigOne;
+    int iOut;
+    while ( 1 )
+    {
+        Pdr_StoLock();
+        if ( Pdr_StoIsStopped(p->pSto) || p->iNext == Saig_ManPoNum(p->pAig) )
+        {
+            Pdr_StoUnlock();
+            break;
+        }
+        iOut = p->iNext++;
+        // duplication uses the data fields of the shared AIG
+        pAigOne = Aig_ManDupOneOutput( p->pAig, iOut, 1 );
+        Aig_ManSetRegNum( pAigOne, Aig_ManRegNum(pAigOne) ); // set CI/CO IDs
+        Pdr_StoUnlock();
+        Pdr_ManSolveOutput( p, iOut, pAigOne );
+        Aig_ManStop( pAigOne );
+    }
+}
+
+#ifndef ABC_USE_PTHREADS
+
+void Pdr_ManSolveOutputsAll( Pdr_All_t * p, int nProcs )
+{
+    Pdr_ManSolveOutputs( p );
+}
+
+#else // pthreads are used
+
+void * Pdr_ManOutputThread( void * pArg )
+{
+    Pdr_ManSolveOutputs( (Pdr_All_t *)pArg );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+void Pdr_ManSolveOutputsAll( Pdr_All_t * p, int nProcs )
+{
+    pthread_t WorkerThread[PDR_THR_MAX];
+    int i, status;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Pdr_ManOutputThread, (void *)p );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of the multi-output AIG concurrently.]
+
+  Description [The outputs are distributed among the workers, which
+  solve them one at a time. The inductive invariants of the proved
+  outputs are shared through the store and added as lemmas to the
+  frames of the outputs solved later. The results are reported as soon
+  as they are found and recorded in the same way as by the sequential
+  engine with "-a". Returns 1 if all outputs are proved, 0 if some
+  output failed, and -1 otherwise.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolveParAll( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    Pdr_All_t All, * p = &All;
+    int k, RetValue, nPos = Saig_ManPoNum(pAig);
+    int nProcs = Abc_MinInt( Abc_MinInt(pPars->nProcs, PDR_THR_MAX), nPos );
+    assert( pPars->fSolveAll && !pPars->fUseAbs );
+    assert( pAig->vSeqModelVec == NULL );
+    memset( p, 0, sizeof(Pdr_All_t) );
+    p->pAig       = pAig;
+    p->pPars      = pPars;
+    p->pSto       = Pdr_StoStart();
+    p->pSto->fLemmasOnly = 1;
+    p->vCexes     = Vec_PtrStart( nPos );
+    p->nOutDigits = Abc_Base10Log( nPos );
+    // the workers run in their own threads, in which Abc_Clock() measures
+    // the CPU time of the thread, so the shared time limit uses the wall clock
+    p->clkStart   = Abc_ClockWall();
+    if ( pPars->nTimeOut )
+        p->pSto->timeToStop = p->clkStart + (abctime)pPars->nTimeOut * CLOCKS_PER_SEC;
+    pPars->nFailOuts  = 0;
+    pPars->nProveOuts = 0;
+    pPars->nDropOuts  = 0;
+    pPars->vOutMap    = Vec_IntAlloc( nPos );
+    Vec_IntFill( pPars->vOutMap, nPos, -2 );
+    Pdr_ManSolveOutputsAll( p, nProcs );
+    // convert all -2 (unknown) entries into -1 (undec)
+    for ( k = 0; k < nPos; k++ )
+        if ( Vec_IntEntry(pPars->vOutMap, k) == -2 ) // unknown
+            Vec_IntWriteEntry( pPars->vOutMap, k, -1 ); // undec
+    pPars->nDropOuts = nPos - pPars->nFailOuts - pPars->nProveOuts;
+    pPars->iFrame    = p->iFrameMax - 1;
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Workers = %d. Shared lemmas = %d. Time = %.2f sec\n", nProcs,
+            Vec_PtrSize(p->pSto->vCubes), 1.0*(Abc_ClockWall() - p->clkStart)/CLOCKS_PER_SEC );
+    pAig->vSeqModelVec = p->vCexes;
+    Pdr_StoStop( p->pSto );
+    if ( pPars->fUseBridge )
+        Gia_ManToBridgeAbort( stdout, 7, (unsigned char *)"timeout" );
+    if ( pPars->nProveOuts == nPos )
+        RetValue = 1; // UNSAT
+    else if ( pPars->nFailOuts > 0 )
+        RetValue = 0; // SAT
+    else
+        RetValue = -1;
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
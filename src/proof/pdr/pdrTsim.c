@@ -494,6 +494,58 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, vCi2Rem );
     return pRes;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the literals of the cube in the next state.]
+
+  Description [Assumes that the SAT solver of frame k has just returned
+  a satisfying assignment, in which the variables of the cones of the
+  next-state functions of the cube flops are present. Simulates these
+  cones once, starting from the values of their CIs in the assignment,
+  and writes into vValues, for each literal of the cube, 1 if the literal
+  holds in the next state and 0 otherwise. Unlike the values of the SAT
+  variables, the simulated values do not depend on the polarity in which
+  the cones were added to the solver.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManTernaryEvalCube( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Vec_Int_t * vValues )
+{
+    Vec_Int_t * vCiObjs = p->vCiObjs;  // cone leaves (CI obj IDs)
+    Vec_Int_t * vCoObjs = p->vCoObjs;  // cone roots (CO obj IDs)
+    Vec_Int_t * vCiVals = p->vCiVals;  // cone leaf values (0/1 CI values)
+    Vec_Int_t * vNodes  = p->vNodes;   // cone nodes (node obj IDs)
+    Aig_Obj_t * pObj;
+    int i, Value;
+    // collect the next-state functions of the cube flops
+    Vec_IntClear( vCoObjs );
+    for ( i = 0; i < pCube->nLits; i++ )
+    {
+        assert( pCube->Lits[i] != -1 );
+        pObj = Saig_ManLi( p->pAig, Abc_Lit2Var(pCube->Lits[i]) );
+        Vec_IntPush( vCoObjs, Aig_ObjId(pObj) );
+    }
+    // simulate their cones
+    Pdr_ManCollectCone( p->pAig, vCoObjs, vCiObjs, vNodes );
+    Pdr_ManCollectValues( p, k, vCiObjs, vCiVals );
+    Pdr_ManSimInfoSet( p->pAig, Aig_ManConst1(p->pAig), PDR_ONE );
+    Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
+        Pdr_ManSimInfoSet( p->pAig, pObj, (Vec_IntEntry(vCiVals, i)?PDR_ONE:PDR_ZER) );
+    Aig_ManForEachObjVec( vNodes, p->pAig, pObj, i )
+        Pdr_ManExtendOneEval( p->pAig, pObj );
+    // compare the next-state values with the literals
+    Vec_IntClear( vValues );
+    Aig_ManForEachObjVec( vCoObjs, p->pAig, pObj, i )
+    {
+        Value = Pdr_ManExtendOneEval( p->pAig, pObj );
+        assert( Value != PDR_UND );
+        Vec_IntPush( vValues, Value == (Abc_LitIsCompl(pCube->Lits[i]) ? PDR_ZER : PDR_ONE) );
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -42,6 +42,7 @@ struct Ssw_Pars_t_
 {
     int              nPartSize;     // size of the partition
     int              nOverSize;     // size of the overlap between partitions
+    int              nProcs;        // the number of concurrent workers for partitions
     int              nFramesK;      // the induction depth
     int              nFramesAddSim; // the number of additional frames to simulate
     int              fConstrs;      // treat the last nConstrs POs as seq constraints
@@ -98,6 +99,7 @@ struct Ssw_RarPars_t_
     int              nRandSeed;
     int              TimeOut;
     int              TimeOutGap;
+    int              nProcs;
     int              fSolveAll;
     int              fSetLastState;
     int              fVerbose;
@@ -110,6 +112,8 @@ struct Ssw_RarPars_t_
     int              fUseFfGrouping;
     int              nSolved;
     Abc_Cex_t *      pCex;
+    int              RunId;         // simulation id in this run 
+    int(*pFuncStop)(int);           // callback to terminate
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
 };
 
@@ -47,6 +47,7 @@ void Ssw_ManSetDefaultParams( Ssw_Pars_t * p )
     memset( p, 0, sizeof(Ssw_Pars_t) );
     p->nPartSize      =       0;  // size of the partition
     p->nOverSize      =       0;  // size of the overlap between partitions
+    p->nProcs         =       1;  // the number of concurrent workers for partitions
     p->nFramesK       =       1;  // the induction depth
     p->nFramesAddSim  =       2;  // additional frames to simulate
     p->fConstrs       =       0;  // treat the last nConstrs POs as seq constraints
@@ -21,6 +21,17 @@
 #include "sswInt.h"
 #include "aig/ioa/ioa.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+    #include "../lib/pthread.h"
+#else
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -28,10 +39,181 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define SSW_THR_MAX 100   // the max number of threads
+
+// the partitions processed by the concurrent workers
+typedef struct Ssw_PartMan_t_ Ssw_PartMan_t;
+struct Ssw_PartMan_t_
+{
+    Aig_Man_t *      pAig;         // the original AIG
+    Vec_Ptr_t *      vResult;      // the partitions (register sets)
+    Ssw_Pars_t *     pPars;        // the parameters
+    int              fVerbose;     // verbosity flag
+    int              iNext;        // the next partition to process
+    Aig_Man_t **     ppParts;      // the partition AIGs with the classes
+    int **           ppMapBacks;   // the maps of partition objects into the original ones
+    int *            pCountPis;    // the number of true PIs of each partition
+    int *            pCountRegs;   // the number of other registers of each partition
+    int *            pIters;       // the number of iterations of each partition
+    int *            pConflicts;   // the number of conflicts of each partition
+};
+
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_SswPartMutex = PTHREAD_MUTEX_INITIALIZER;
+static inline void Ssw_PartLock()   { int status = pthread_mutex_lock( &s_SswPartMutex );    assert( status == 0 ); (void)status; }
+static inline void Ssw_PartUnlock() { int status = pthread_mutex_unlock( &s_SswPartMutex );  assert( status == 0 ); (void)status; }
+#else
+static inline void Ssw_PartLock()   {}
+static inline void Ssw_PartUnlock() {}
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Processes partitions until there are none left.]
+
+  Description [The partition AIGs are derived from the original AIG under
+  the lock, because this updates the traversal IDs and the data fields
+  of its objects. After this, each partition is an independent AIG with
+  its own induction manager and SAT solver. Ssw_SignalCorrespondence()
+  restarts the random generator of the calling thread, so each partition
+  is simulated with the same patterns as in the sequential flow.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Ssw_SignalCorrespondenceWorker( Ssw_PartMan_t * p )
+{
+    Ssw_Pars_t Pars, * pPars = &Pars;
+    Aig_Man_t * pTemp, * pNew;
+    Vec_Int_t * vPart;
+    int i;
+    while ( 1 )
+    {
+        Ssw_PartLock();
+        i = p->iNext++;
+        if ( i >= Vec_PtrSize(p->vResult) )
+        {
+            Ssw_PartUnlock();
+            break;
+        }
+        vPart = (Vec_Int_t *)Vec_PtrEntry( p->vResult, i );
+        pTemp = Aig_ManRegCreatePart( p->pAig, vPart, p->pCountPis + i, p->pCountRegs + i, p->ppMapBacks + i );
+        Aig_ManSetRegNum( pTemp, pTemp->nRegs );
+        // create the projection of 1-hot registers
+        if ( p->pAig->vOnehots )
+            pTemp->vOnehots = Aig_ManRegProjectOnehots( p->pAig, pTemp, p->pAig->vOnehots, p->fVerbose );
+        Ssw_PartUnlock();
+        // run SSW
+        if ( p->pCountPis[i] > 0 )
+        {
+            *pPars = *p->pPars;
+            pPars->nConflicts = 0;
+            pNew = Ssw_SignalCorrespondence( pTemp, pPars );
+            p->pIters[i] = pPars->nIters;
+            p->pConflicts[i] = pPars->nConflicts;
+            Aig_ManStop( pNew );
+        }
+        p->ppParts[i] = pTemp;
+    }
+}
+
+#ifdef ABC_USE_PTHREADS
+
+void * Ssw_SignalCorrespondenceWorkerThread( void * pArg )
+{
+    Ssw_SignalCorrespondenceWorker( (Ssw_PartMan_t *)pArg );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+void Ssw_SignalCorrespondenceRunWorkers( Ssw_PartMan_t * p, int nProcs )
+{
+    pthread_t WorkerThread[SSW_THR_MAX];
+    int i, status;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Ssw_SignalCorrespondenceWorkerThread, (void *)p );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+}
+
+#else
+
+void Ssw_SignalCorrespondenceRunWorkers( Ssw_PartMan_t * p, int nProcs )
+{
+    Ssw_SignalCorrespondenceWorker( p );
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Performs sequential SAT sweeping of partitions concurrently.]
+
+  Description [The classes of the partitions are transferred to the
+  original AIG in the order of the partitions after all of them are
+  processed, which gives the same result as the sequential flow.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Ssw_SignalCorrespondencePartPar( Aig_Man_t * pAig, Vec_Ptr_t * vResult, Ssw_Pars_t * pPars, int fVerbose )
+{
+    Ssw_PartMan_t Man, * p = &Man;
+    Vec_Int_t * vPart;
+    int i, nClasses, nParts = Vec_PtrSize(vResult);
+    int nProcs = Abc_MinInt( Abc_MinInt(pPars->nProcs, SSW_THR_MAX), nParts );
+    memset( p, 0, sizeof(Ssw_PartMan_t) );
+    p->pAig       = pAig;
+    p->vResult    = vResult;
+    p->pPars      = pPars;
+    p->fVerbose   = fVerbose;
+    p->ppParts    = ABC_CALLOC( Aig_Man_t *, nParts );
+    p->ppMapBacks = ABC_CALLOC( int *, nParts );
+    p->pCountPis  = ABC_CALLOC( int, nParts );
+    p->pCountRegs = ABC_CALLOC( int, nParts );
+    p->pIters     = ABC_CALLOC( int, nParts );
+    p->pConflicts = ABC_CALLOC( int, nParts );
+    if ( fVerbose )
+        Abc_Print( 1, "Processing %d partitions using %d concurrent workers.\n", nParts, nProcs );
+    Ssw_SignalCorrespondenceRunWorkers( p, nProcs );
+    // transfer the classes
+    Vec_PtrForEachEntry( Vec_Int_t *, vResult, vPart, i )
+    {
+        if ( p->pCountPis[i] > 0 )
+        {
+            nClasses = Aig_TransferMappedClasses( pAig, p->ppParts[i], p->ppMapBacks[i] );
+            if ( fVerbose )
+                Abc_Print( 1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
+                    i, Vec_IntSize(vPart), Aig_ManCiNum(p->ppParts[i])-Vec_IntSize(vPart), p->pCountPis[i], p->pCountRegs[i], 
+                    Aig_ManNodeNum(p->ppParts[i]), p->pIters[i], nClasses );
+            pPars->nIters = Abc_MaxInt( pPars->nIters, p->pIters[i] );
+            pPars->nConflicts += p->pConflicts[i];
+        }
+        Aig_ManStop( p->ppParts[i] );
+        ABC_FREE( p->ppMapBacks[i] );
+    }
+    ABC_FREE( p->ppParts );
+    ABC_FREE( p->ppMapBacks );
+    ABC_FREE( p->pCountPis );
+    ABC_FREE( p->pCountRegs );
+    ABC_FREE( p->pIters );
+    ABC_FREE( p->pConflicts );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs partitioned sequential SAT sweeping.]
@@ -97,24 +279,29 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
 
     // perform SSW with partitions
     Aig_ManReprStart( pAig, Aig_ManObjNumMax(pAig) );
-    Vec_PtrForEachEntry( Vec_Int_t *, vResult, vPart, i )
+    if ( pPars->nProcs > 1 )
+        Ssw_SignalCorrespondencePartPar( pAig, vResult, pPars, fVerbose );
+    else
     {
-        pTemp = Aig_ManRegCreatePart( pAig, vPart, &nCountPis, &nCountRegs, &pMapBack );
-        Aig_ManSetRegNum( pTemp, pTemp->nRegs );
-        // create the projection of 1-hot registers
-        if ( pAig->vOnehots )
-            pTemp->vOnehots = Aig_ManRegProjectOnehots( pAig, pTemp, pAig->vOnehots, fVerbose );
-        // run SSW
-        if (nCountPis>0) {
-            pNew = Ssw_SignalCorrespondence( pTemp, pPars );
-            nClasses = Aig_TransferMappedClasses( pAig, pTemp, pMapBack );
-            if ( fVerbose )
-                Abc_Print( 1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
-                    i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp)-Vec_IntSize(vPart), nCountPis, nCountRegs, Aig_ManNodeNum(pTemp), pPars->nIters, nClasses );
-            Aig_ManStop( pNew );
+        Vec_PtrForEachEntry( Vec_Int_t *, vResult, vPart, i )
+        {
+            pTemp = Aig_ManRegCreatePart( pAig, vPart, &nCountPis, &nCountRegs, &pMapBack );
+            Aig_ManSetRegNum( pTemp, pTemp->nRegs );
+            // create the projection of 1-hot registers
+            if ( pAig->vOnehots )
+                pTemp->vOnehots = Aig_ManRegProjectOnehots( pAig, pTemp, pAig->vOnehots, fVerbose );
+            // run SSW
+            if (nCountPis>0) {
+                pNew = Ssw_SignalCorrespondence( pTemp, pPars );
+                nClasses = Aig_TransferMappedClasses( pAig, pTemp, pMapBack );
+                if ( fVerbose )
+                    Abc_Print( 1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
+                        i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp)-Vec_IntSize(vPart), nCountPis, nCountRegs, Aig_ManNodeNum(pTemp), pPars->nIters, nClasses );
+                Aig_ManStop( pNew );
+            }
+            Aig_ManStop( pTemp );
+            ABC_FREE( pMapBack );
         }
-        Aig_ManStop( pTemp );
-        ABC_FREE( pMapBack );
     }
     // remap the AIG
     pNew = Aig_ManDupRepr( pAig, 0 );
@@ -20,6 +20,17 @@
 
 #include "sswInt.h"
 #include "aig/gia/giaAig.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+    #include "../lib/pthread.h"
+#else
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+#endif
 #include "base/main/main.h"
 #include "sat/bmc/bmc.h"
 
@@ -30,6 +41,27 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define SSW_RAR_THR_MAX 100   // the max number of threads
+
+// the state shared by the concurrent workers
+typedef struct Ssw_RarShare_t_ Ssw_RarShare_t;
+struct Ssw_RarShare_t_
+{
+    int            nWorkers;     // the number of workers
+    int            iWinner;      // the first worker to find a CEX
+};
+
+// the data of one worker
+typedef struct Ssw_RarThData_t_ Ssw_RarThData_t;
+struct Ssw_RarThData_t_
+{
+    Aig_Man_t *    pAig;         // the private copy of the AIG
+    Ssw_RarPars_t  Pars;         // the private copy of the parameters
+    Ssw_RarShare_t * pShare;     // the shared state
+    int            iWorker;      // the number of this worker
+    int            RetValue;     // the result of this worker
+};
+
 typedef struct Ssw_RarMan_t_ Ssw_RarMan_t;
 struct Ssw_RarMan_t_
 {
@@ -56,8 +88,23 @@ struct Ssw_RarMan_t_
     int            iFailPat;     // failed pattern
     // counter-examples
     Vec_Ptr_t *    vCexes;
+    // random number generator
+    unsigned       RandZ;        // the state of the generator
+    unsigned       RandW;        // the state of the generator
+    // concurrent workers
+    Ssw_RarShare_t * pShare;     // the shared state
+    int            iWorker;      // the number of this worker
 };
 
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_RarParMutex = PTHREAD_MUTEX_INITIALIZER;
+static inline void Ssw_RarParLock()   { int status = pthread_mutex_lock( &s_RarParMutex );    assert( status == 0 ); (void)status; }
+static inline void Ssw_RarParUnlock() { int status = pthread_mutex_unlock( &s_RarParMutex );  assert( status == 0 ); (void)status; }
+#else
+static inline void Ssw_RarParLock()   {}
+static inline void Ssw_RarParUnlock() {}
+#endif
+
 
 static inline int  Ssw_RarGetBinPat( Ssw_RarMan_t * p, int iBin, int iPat )
 {
@@ -110,6 +157,7 @@ void Ssw_RarSetDefaultParams( Ssw_RarPars_t * p )
     p->nRandSeed     =   0;
     p->TimeOut       =   0;
     p->TimeOutGap    =   0;
+    p->nProcs        =   1;
     p->fSolveAll     =   0;
     p->fDropSatOuts  =   0;
     p->fSetLastState =   0;
@@ -117,6 +165,31 @@ void Ssw_RarSetDefaultParams( Ssw_RarPars_t * p )
     p->fNotVerbose   =   0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the next random number.]
+
+  Description [Produces the same sequence as Aig_ManRandom() but keeps 
+  the state in the manager, so that concurrent workers do not interfere
+  with each other and each can replay its sequence to derive the CEX.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Ssw_RarManRandom( Ssw_RarMan_t * p )
+{
+    p->RandZ = 36969 * (p->RandZ & 65535) + (p->RandZ >> 16);
+    p->RandW = 18000 * (p->RandW & 65535) + (p->RandW >> 16);
+    return (p->RandZ << 16) + p->RandW;
+}
+static inline word Ssw_RarManRandom64( Ssw_RarMan_t * p )
+{
+    word Res = (word)Ssw_RarManRandom( p );
+    return Res | ((word)Ssw_RarManRandom( p ) << 32);
+}
+
 /**Function*************************************************************
 
   Synopsis    [Prepares random number generator.]
@@ -128,12 +201,13 @@ void Ssw_RarSetDefaultParams( Ssw_RarPars_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-void Ssw_RarManPrepareRandom( int nRandSeed )
+void Ssw_RarManPrepareRandom( Ssw_RarMan_t * p, int nRandSeed )
 {
     int i;
-    Aig_ManRandom( 1 );
-    for ( i = 0; i < nRandSeed; i++ )
-        Aig_ManRandom( 0 );
+    p->RandZ = 3716960521u;
+    p->RandW = 2174103536u;
+    for ( i = 0; i <= nRandSeed; i++ )
+        Ssw_RarManRandom( p );
 }
 
 /**Function*************************************************************
@@ -156,7 +230,7 @@ void Ssw_RarManAssingRandomPis( Ssw_RarMan_t * p )
     {
         pSim = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
         for ( w = 0; w < p->pPars->nWords; w++ )
-            pSim[w] = Aig_ManRandom64(0);
+            pSim[w] = Ssw_RarManRandom64( p );
 //        pSim[0] <<= 1;
 //        pSim[0] = (pSim[0] << 2) | 2;
         pSim[0] = (pSim[0] << 4) | ((i & 1) ? 0xA : 0xC);
@@ -961,7 +1035,7 @@ int Ssw_RarCheckTrivial( Aig_Man_t * pAig, int fVerbose )
 
 /**Function*************************************************************
 
-  Synopsis    [Perform sequential simulation.]
+  Synopsis    [Returns 1 if another worker has found a CEX.]
 
   Description []
                
@@ -970,7 +1044,56 @@ int Ssw_RarCheckTrivial( Aig_Man_t * pAig, int fVerbose )
   SeeAlso     []
 
 ***********************************************************************/
-int Ssw_RarSimulate( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
+int Ssw_RarParIsDone( Ssw_RarMan_t * p )
+{
+    int RetValue;
+    if ( p->pShare == NULL )
+        return 0;
+    Ssw_RarParLock();
+    RetValue = p->pShare->iWinner >= 0 && p->pShare->iWinner != p->iWorker;
+    Ssw_RarParUnlock();
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if this worker is the first to find a CEX.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ssw_RarParClaimCex( Ssw_RarMan_t * p )
+{
+    int RetValue;
+    if ( p->pShare == NULL )
+        return 1;
+    Ssw_RarParLock();
+    if ( p->pShare->iWinner == -1 )
+        p->pShare->iWinner = p->iWorker;
+    RetValue = p->pShare->iWinner == p->iWorker;
+    Ssw_RarParUnlock();
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Perform sequential simulation.]
+
+  Description [When pShare is not NULL, this is one of the concurrent
+  workers, which stops as soon as any worker finds a CEX. The workers 
+  start from different random seeds and, after a restart, advance the
+  seed by the number of workers, so that they never repeat each other.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ssw_RarSimulateInt( Aig_Man_t * pAig, Ssw_RarPars_t * pPars, Ssw_RarShare_t * pShare, int iWorker )
 {
     int fTryBmc = 0;
     int fMiter = 1;
@@ -995,12 +1118,13 @@ int Ssw_RarSimulate( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
     if ( pPars->fVerbose )
         Abc_Print( 1, "Rarity simulation with %d words, %d frames, %d rounds, %d restart, %d seed, and %d sec timeout.\n",
             pPars->nWords, pPars->nFrames, pPars->nRounds, pPars->nRestart, pPars->nRandSeed, pPars->TimeOut );
-    // reset random numbers
-    Ssw_RarManPrepareRandom( nSavedSeed );
-
     // create manager
     p = Ssw_RarManStart( pAig, pPars );
     p->vInits = Vec_IntStart( Aig_ManRegNum(pAig) * pPars->nWords );
+    p->pShare = pShare;
+    p->iWorker = iWorker;
+    // reset random numbers
+    Ssw_RarManPrepareRandom( p, nSavedSeed );
 
     // perform simulation rounds
     pPars->nSolved = 0;
@@ -1030,24 +1154,32 @@ int Ssw_RarSimulate( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
                 }
                 if ( Status == 1 ) // found CEX
                 {
+                    if ( !pPars->fSolveAll && !Ssw_RarParClaimCex( p ) )
+                        goto finish;
                     RetValue = 0;
                     if ( !pPars->fSolveAll )
                     {
                         if ( pPars->fVerbose ) Abc_Print( 1, "\n" );
         //                Abc_Print( 1, "Simulation asserted a PO in frame f: %d <= f < %d.\n", r * nFrames, (r+1) * nFrames );
-                        Ssw_RarManPrepareRandom( nSavedSeed );
+                        Ssw_RarManPrepareRandom( p, nSavedSeed );
                         if ( pPars->fVerbose )
                             Abc_Print( 1, "Simulated %d frames for %d rounds with %d restarts.\n", pPars->nFrames, nNumRestart * pPars->nRestart + r, nNumRestart );
                         pAig->pSeqModel = Ssw_RarDeriveCex( p, r * p->pPars->nFrames + f, p->iFailPo, p->iFailPat, pPars->fVerbose );
-                        // print final report
-                        Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d.  ", pAig->pSeqModel->iPo, pAig->pName, pAig->pSeqModel->iFrame );
-                        Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+                        // print final report (the concurrent run is reported by the caller)
+                        if ( !pPars->fSilent && pShare == NULL )
+                        {
+                            Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d.  ", pAig->pSeqModel->iPo, pAig->pName, pAig->pSeqModel->iFrame );
+                            Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+                        }
                         goto finish;
                     }
                     timeLastSolved = Abc_Clock();
                 }
                 // else - did not find a counter example
             }
+            // stop if another worker has found a CEX or the caller has cancelled
+            if ( Ssw_RarParIsDone( p ) || (pPars->pFuncStop && pPars->pFuncStop(pPars->RunId)) )
+                goto finish;
             // check timeout
             if ( pPars->TimeOut && Abc_Clock() > nTimeToStop )
             {
@@ -1077,8 +1209,8 @@ int Ssw_RarSimulate( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
         if ( pPars->nRestart && r == pPars->nRestart )
         {
             r = -1;
-            nSavedSeed = (nSavedSeed + 1) % 1000;
-            Ssw_RarManPrepareRandom( nSavedSeed );
+            nSavedSeed = (nSavedSeed + (pShare ? pShare->nWorkers : 1)) % 1000;
+            Ssw_RarManPrepareRandom( p, nSavedSeed );
             Vec_IntFill( p->vInits, Aig_ManRegNum(pAig) * pPars->nWords, 0 );
             nNumRestart++;
             Vec_IntClear( p->vPatBests );
@@ -1136,6 +1268,152 @@ finish:
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Runs the concurrent workers.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+void * Ssw_RarWorkerThread( void * pArg )
+{
+    Ssw_RarThData_t * pThData = (Ssw_RarThData_t *)pArg;
+    pThData->RetValue = Ssw_RarSimulateInt( pThData->pAig, &pThData->Pars, pThData->pShare, pThData->iWorker );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+void Ssw_RarRunWorkers( Ssw_RarThData_t * pThData, int nProcs )
+{
+    pthread_t WorkerThread[SSW_RAR_THR_MAX];
+    int i, status;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Ssw_RarWorkerThread, (void *)(pThData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+}
+
+#else
+
+void Ssw_RarRunWorkers( Ssw_RarThData_t * pThData, int nProcs )
+{
+    int i;
+    for ( i = 0; i < nProcs; i++ )
+        pThData[i].RetValue = Ssw_RarSimulateInt( pThData[i].pAig, &pThData[i].Pars, pThData[i].pShare, pThData[i].iWorker );
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Performs sequential simulation using concurrent workers.]
+
+  Description [Each worker simulates its own copy of the AIG, because 
+  the simulation updates the traversal IDs and CEX verification updates
+  the marks of the AIG objects. Worker i starts from the random seed 
+  shifted by i and, on each restart, advances its seed by the number of
+  workers, so the workers explore disjoint seed sequences. Only the first
+  restart interval of worker 0 matches the single-threaded run. The
+  counter-example of the winning worker is reported here, since all
+  workers except the first one are silent.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ssw_RarSimulatePar( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
+{
+    Ssw_RarThData_t * pThData;
+    Ssw_RarShare_t Share, * pShare = &Share;
+    int i, RetValue = -1, nProcs = Abc_MinInt( pPars->nProcs, SSW_RAR_THR_MAX );
+    abctime clkTotal = Abc_ClockWall();
+    assert( !pPars->fSolveAll );
+    ABC_FREE( pAig->pSeqModel );
+    pShare->nWorkers = nProcs;
+    pShare->iWinner  = -1;
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Running %d workers with random seeds %d to %d.\n", nProcs, pPars->nRandSeed, pPars->nRandSeed + nProcs - 1 );
+    pThData = ABC_CALLOC( Ssw_RarThData_t, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData[i].pAig      = Aig_ManDupSimple( pAig );
+        pThData[i].Pars      = *pPars;
+        pThData[i].Pars.nProcs    = 1;
+        pThData[i].Pars.nRandSeed = (pPars->nRandSeed + i) % 1000;
+        pThData[i].pShare    = pShare;
+        pThData[i].iWorker   = i;
+        pThData[i].RetValue  = -1;
+        // only the first worker reports the progress
+        if ( i > 0 )
+        {
+            pThData[i].Pars.fVerbose    = 0;
+            pThData[i].Pars.fNotVerbose = 1;
+            pThData[i].Pars.fSilent     = 1;
+        }
+    }
+    Ssw_RarRunWorkers( pThData, nProcs );
+    // collect the results
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Vec_Int_t * vInits = (Vec_Int_t *)pThData[i].pAig->pData;
+        pThData[i].pAig->pData = NULL;
+        if ( vInits && i == Abc_MaxInt(pShare->iWinner, 0) )
+        {
+            Vec_IntFreeP( (Vec_Int_t **)&pAig->pData );
+            pAig->pData = vInits;
+        }
+        else
+            Vec_IntFreeP( &vInits );
+    }
+    if ( pShare->iWinner >= 0 )
+    {
+        Aig_Man_t * pAigWin = pThData[pShare->iWinner].pAig;
+        pAig->pSeqModel = pAigWin->pSeqModel;
+        pAigWin->pSeqModel = NULL;
+        RetValue = 0;
+        if ( !pPars->fSilent )
+        {
+            Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d.  ", pAig->pSeqModel->iPo, pAig->pName, pAig->pSeqModel->iFrame );
+            Abc_PrintTime( 1, "Time", Abc_ClockWall() - clkTotal );
+        }
+    }
+    for ( i = 0; i < nProcs; i++ )
+        Aig_ManStop( pThData[i].pAig );
+    ABC_FREE( pThData );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Perform sequential simulation.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ssw_RarSimulate( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
+{
+    if ( pPars->nProcs > 1 && !pPars->fSolveAll )
+        return Ssw_RarSimulatePar( pAig, pPars );
+    return Ssw_RarSimulateInt( pAig, pPars, NULL, 0 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derive random flop permutation.]
@@ -1236,11 +1514,10 @@ int Ssw_RarSignalFilter( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
     if ( pPars->fVerbose )
         Abc_Print( 1, "Rarity equiv filtering with %d words, %d frames, %d rounds, %d seed, and %d sec timeout.\n",
             pPars->nWords, pPars->nFrames, pPars->nRounds, pPars->nRandSeed, pPars->TimeOut );
-    // reset random numbers
-    Ssw_RarManPrepareRandom( nSavedSeed );
-
     // create manager
     p = Ssw_RarManStart( pAig, pPars );
+    // reset random numbers
+    Ssw_RarManPrepareRandom( p, nSavedSeed );
     // compute starting state if needed
     assert( p->vInits == NULL );
     if ( pPars->pCex )
@@ -1288,7 +1565,7 @@ int Ssw_RarSignalFilter( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
 //                Abc_Print( 1, "Simulation asserted a PO in frame f: %d <= f < %d.\n", r * pPars->nFrames, (r+1) * pPars->nFrames );
                 if ( pPars->fVerbose )
                     Abc_Print( 1, "Simulated %d frames for %d rounds with %d restarts.\n", pPars->nFrames, nNumRestart * pPars->nRestart + r, nNumRestart );
-                Ssw_RarManPrepareRandom( nSavedSeed );
+                Ssw_RarManPrepareRandom( p, nSavedSeed );
                 Abc_CexFree( pAig->pSeqModel );
                 pAig->pSeqModel = Ssw_RarDeriveCex( p, r * p->pPars->nFrames + f, p->iFailPo, p->iFailPat, 1 );
                 // print final report
@@ -1311,7 +1588,7 @@ int Ssw_RarSignalFilter( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
         {
             r = -1;
             nSavedSeed = (nSavedSeed + 1) % 1000;
-            Ssw_RarManPrepareRandom( nSavedSeed );
+            Ssw_RarManPrepareRandom( p, nSavedSeed );
             Vec_IntFill( p->vInits, Aig_ManRegNum(pAig) * pPars->nWords, 0 );
             nNumRestart++;
             Vec_IntClear( p->vPatBests );
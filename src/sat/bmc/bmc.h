@@ -97,6 +97,7 @@ struct Saig_ParBmc_t_
     int         nTimeOutGap;    // approximate timeout in seconds since the last change
     int         nTimeOutOne;    // timeout per output in multi-output solving
     int         nPisAbstract;   // the number of PIs to abstract
+    int         nProcs;         // the number of concurrent workers
     int         fSolveAll;      // does not stop at the first SAT output
     int         fStoreCex;      // enable storing CEXes in the MO mode
     int         fUseBridge;     // use bridge interface
@@ -106,6 +107,7 @@ struct Saig_ParBmc_t_
     int         fNoRestarts;    // disables periodic restarts
     int         fUseSatoko;     // enables using Satoko
     int         fUseGlucose;    // enables using Glucose 3.0
+    int         fCompactFrames; // compacts the data of closed timeframes
     int         nLearnedStart;  // starting learned clause limit
     int         nLearnedDelta;  // delta of learned clause limit
     int         nLearnedPerce;  // ratio of learned clause limit
@@ -120,6 +122,7 @@ struct Saig_ParBmc_t_
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
     int         RunId;          // BMC id in this run 
     int(*pFuncStop)(int);       // callback to terminate
+    void(*pFuncOnFrameDone)(int,int,int,int); // called for each solved output (RunId, frame, output, status)
 };
 
  
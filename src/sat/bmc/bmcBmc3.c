@@ -27,12 +27,47 @@
 #include "misc/vec/vecWec.h"
 #include "bmc.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+    #include "../lib/pthread.h"
+#else
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define BMC3_THR_MAX 100   // the max number of threads
+
+// the state shared by the concurrent workers
+typedef struct Saig_Bmc3Par_t_ Saig_Bmc3Par_t;
+struct Saig_Bmc3Par_t_
+{
+    int               nWorkers;    // the number of workers
+    int               fByFrames;   // the workers own frames (otherwise, outputs)
+    int               iFrameBest;  // the earliest frame where a worker stopped
+    int               iOutBest;    // the output in this frame where a worker stopped
+    int               iWinner;     // the worker that stopped there
+    int               fCexBest;    // the worker stopped because the output failed
+};
+
+// the data of one worker
+typedef struct Saig_Bmc3ThData_t_
+{
+    Aig_Man_t *       pAig;       // the private copy of the AIG
+    Saig_ParBmc_t *   pPars;      // the private copy of the parameters
+    Saig_Bmc3Par_t *  pShare;     // the shared state
+    int               iWorker;    // the number of this worker
+    int               RetValue;   // the result of this worker
+} Saig_Bmc3ThData_t;
+
 typedef struct Gia_ManBmc_t_ Gia_ManBmc_t;
 struct Gia_ManBmc_t_
 {
@@ -66,10 +101,26 @@ struct Gia_ManBmc_t_
     bmcg_sat_solver * pSat3;       // SAT solver
     int               nSatVars;    // SAT variables
     int               nObjNums;    // SAT objects
+    int               nIntNums;    // SAT objects on the timeframe boundary
     int               nWordNum;    // unsigned words for ternary simulation
     char * pSopSizes, ** pSops;    // CNF representation
+    // compaction of timeframes
+    Vec_Int_t *       vCoiLis;     // register inputs in the COI of the outputs
+    int               iFrameOpen;  // the first timeframe that is not compacted
+    // concurrent workers
+    Saig_Bmc3Par_t *  pShare;      // the shared state
+    int               iWorker;     // the number of this worker
 };
 
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_Bmc3ParMutex = PTHREAD_MUTEX_INITIALIZER;
+static inline void Saig_Bmc3ParLock()   { int status = pthread_mutex_lock( &s_Bmc3ParMutex );    assert( status == 0 ); (void)status; }
+static inline void Saig_Bmc3ParUnlock() { int status = pthread_mutex_unlock( &s_Bmc3ParMutex );  assert( status == 0 ); (void)status; }
+#else
+static inline void Saig_Bmc3ParLock()   {}
+static inline void Saig_Bmc3ParUnlock() {}
+#endif
+
 extern int Gia_ManToBridgeResult( FILE * pFile, int Result, Abc_Cex_t * pCex, int iPoProved );
 
 void Gia_ManReportProgress( FILE * pFile, int prop_no, int depth )
@@ -732,16 +783,18 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLi
     // create sections
 //    p->vSects = Saig_ManBmcSections( pAig );
     // map object IDs into their numbers and section numbers
+    // (the boundary objects come first, to be kept when the frame is compacted)
     p->nObjNums = 0;
     p->vId2Num  = Vec_IntStartFull( Aig_ManObjNumMax(pAig) );
     Vec_IntWriteEntry( p->vId2Num,  Aig_ObjId(Aig_ManConst1(pAig)), p->nObjNums++ );
     Aig_ManForEachCi( pAig, pObj, i )
         Vec_IntWriteEntry( p->vId2Num,  Aig_ObjId(pObj), p->nObjNums++ );
+    Aig_ManForEachCo( pAig, pObj, i )
+        Vec_IntWriteEntry( p->vId2Num,  Aig_ObjId(pObj), p->nObjNums++ );
+    p->nIntNums = p->nObjNums;
     Aig_ManForEachNode( pAig, pObj, i )
         if ( Vec_IntEntry(p->vMapping, Aig_ObjId(pObj)) > 0 )
             Vec_IntWriteEntry( p->vId2Num,  Aig_ObjId(pObj), p->nObjNums++ );
-    Aig_ManForEachCo( pAig, pObj, i )
-        Vec_IntWriteEntry( p->vId2Num,  Aig_ObjId(pObj), p->nObjNums++ );
     p->vId2Var  = Vec_PtrAlloc( 100 );
     p->vTerInfo = Vec_PtrAlloc( 100 );
     p->vVisited = Vec_WecAlloc( 100 );
@@ -825,6 +878,7 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
     Vec_IntFree( p->vMapRefs );
 //    Vec_VecFree( p->vSects );
     Vec_IntFree( p->vId2Num );
+    Vec_IntFreeP( &p->vCoiLis );
     Vec_VecFree( (Vec_Vec_t *)p->vId2Var );
     Vec_PtrFreeFree( p->vTerInfo );
     if ( p->pSat )  sat_solver_delete( p->pSat );
@@ -1179,7 +1233,9 @@ void Saig_ManBmcCreateCnf_iter( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame,
 int Saig_ManBmcRunTerSim_rec( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame )
 {
     unsigned * pInfo = (unsigned *)Vec_PtrEntry( p->vTerInfo, iFrame );
-    int Val0, Val1, Value = Saig_ManBmcSimInfoGet( pInfo, pObj );
+    int Val0, Val1, Value;
+    assert( pInfo != NULL );
+    Value = Saig_ManBmcSimInfoGet( pInfo, pObj );
     if ( Value != SAIG_TER_NON )
     {
 /*
@@ -1320,6 +1376,116 @@ int Aig_NodeCompareRefsIncrease( Aig_Obj_t ** pp1, Aig_Obj_t ** pp2 )
     return 0; 
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Collects register inputs in the sequential COI of the outputs.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Saig_ManBmcCollectCoiLis( Aig_Man_t * pAig )
+{
+    Vec_Int_t * vLis = Vec_IntAlloc( Aig_ManRegNum(pAig) );
+    Vec_Ptr_t * vStack = Vec_PtrAlloc( 100 );
+    Aig_Obj_t * pObj;
+    int i;
+    Aig_ManIncrementTravId( pAig );
+    Saig_ManForEachPo( pAig, pObj, i )
+        Vec_PtrPush( vStack, pObj );
+    while ( Vec_PtrSize(vStack) > 0 )
+    {
+        pObj = (Aig_Obj_t *)Vec_PtrPop( vStack );
+        if ( Aig_ObjIsTravIdCurrent(pAig, pObj) )
+            continue;
+        Aig_ObjSetTravIdCurrent(pAig, pObj);
+        if ( Aig_ObjIsCo(pObj) )
+        {
+            if ( Saig_ObjIsLi(pAig, pObj) )
+                Vec_IntPush( vLis, Aig_ObjId(pObj) );
+            Vec_PtrPush( vStack, Aig_ObjFanin0(pObj) );
+        }
+        else if ( Aig_ObjIsNode(pObj) )
+        {
+            Vec_PtrPush( vStack, Aig_ObjFanin0(pObj) );
+            Vec_PtrPush( vStack, Aig_ObjFanin1(pObj) );
+        }
+        else if ( Saig_ObjIsLo(pAig, pObj) )
+            Vec_PtrPush( vStack, Saig_ObjLoToLi(pAig, pObj) );
+    }
+    Vec_PtrFree( vStack );
+    return vLis;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compacts the data of the closed timeframes.]
+
+  Description [A timeframe is closed when all register inputs in the COI
+  of the outputs have SAT literals. After this, the later timeframes only
+  look up the literals of the boundary objects (PIs, registers, and COs)
+  in this timeframe, while the literals of the internal nodes and the
+  ternary values of the previous timeframe are no longer used. The CNF
+  of the closed timeframes stays in the solver, because it encodes the
+  paths from the initial state explored by the later timeframes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcCompactFrames( Gia_ManBmc_t * p, int iFrame )
+{
+    Vec_Int_t * vFrame;
+    Aig_Obj_t * pObj;
+    int i;
+    if ( p->vCoiLis == NULL )
+        p->vCoiLis = Saig_ManBmcCollectCoiLis( p->pAig );
+    for ( ; p->iFrameOpen < iFrame; p->iFrameOpen++ )
+    {
+        Aig_ManForEachObjVec( p->vCoiLis, p->pAig, pObj, i )
+            if ( Saig_ManBmcLiteral( p, pObj, p->iFrameOpen ) == ~0 )
+                return;
+        vFrame = (Vec_Int_t *)Vec_PtrEntry( p->vId2Var, p->iFrameOpen );
+        Vec_IntShrink( vFrame, p->nIntNums );
+        vFrame->pArray = ABC_REALLOC( int, vFrame->pArray, p->nIntNums );
+        vFrame->nCap   = p->nIntNums;
+        if ( p->iFrameOpen > 0 )
+        {
+            unsigned * pInfo = (unsigned *)Vec_PtrEntry( p->vTerInfo, p->iFrameOpen-1 );
+            ABC_FREE( pInfo );
+            Vec_PtrWriteEntry( p->vTerInfo, p->iFrameOpen-1, NULL );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the memory used by the timeframe data.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+double Saig_ManBmcFrameMemory( Gia_ManBmc_t * p )
+{
+    Vec_Int_t * vFrame;
+    double Memory = 0;
+    int i;
+    Vec_PtrForEachEntry( Vec_Int_t *, p->vId2Var, vFrame, i )
+        Memory += 4.0 * Vec_IntCap(vFrame);
+    for ( i = 0; i < Vec_PtrSize(p->vTerInfo); i++ )
+        if ( Vec_PtrEntry(p->vTerInfo, i) )
+            Memory += 4.0 * p->nWordNum;
+    return Memory;
+}
+
 /**Function*************************************************************
 
   Synopsis    [This procedure sets default parameters.]
@@ -1342,6 +1508,7 @@ void Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p )
     p->nTimeOut       =     0;    // approximate timeout in seconds
     p->nTimeOutGap    =     0;    // time since the last CEX found
     p->nPisAbstract   =     0;    // the number of PIs to abstract
+    p->nProcs         =     1;    // the number of concurrent workers
     p->fSolveAll      =     0;    // stops on the first SAT instance
     p->fDropSatOuts   =     0;    // replace sat outputs by constant 0
     p->nLearnedStart  = 10000;    // starting learned clause limit
@@ -1449,7 +1616,34 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
 
 /**Function*************************************************************
 
-  Synopsis    [Bounded model checking engine.]
+  Synopsis    [Returns 1 if this worker should solve the output in the frame.]
+
+  Description [Each pair (frame, output) is owned by exactly one worker.
+  The pairs following the earliest pair where some worker has stopped
+  are not solved because they cannot change the result.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_Bmc3ParOwns( Gia_ManBmc_t * p, int f, int i )
+{
+    Saig_Bmc3Par_t * pShare = p->pShare;
+    int RetValue;
+    if ( pShare == NULL )
+        return 1;
+    if ( (pShare->fByFrames ? f : i) % pShare->nWorkers != p->iWorker )
+        return 0;
+    Saig_Bmc3ParLock();
+    RetValue = f < pShare->iFrameBest || (f == pShare->iFrameBest && i < pShare->iOutBest);
+    Saig_Bmc3ParUnlock();
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the frame follows the earliest stopping point.]
 
   Description []
                
@@ -1458,7 +1652,60 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
   SeeAlso     []
 
 ***********************************************************************/
-int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+int Saig_Bmc3ParIsDone( Gia_ManBmc_t * p, int f )
+{
+    int RetValue;
+    if ( p->pShare == NULL )
+        return 0;
+    Saig_Bmc3ParLock();
+    RetValue = f > p->pShare->iFrameBest;
+    Saig_Bmc3ParUnlock();
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the pair where this worker has stopped.]
+
+  Description [The worker stops either because the output has failed
+  (fCex = 1) or because it could not be decided (fCex = 0). Only the
+  earliest pair is kept, which guarantees that the reported CEX has
+  the smallest frame and the smallest output in this frame.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_Bmc3ParReport( Gia_ManBmc_t * p, int f, int i, int fCex )
+{
+    Saig_Bmc3Par_t * pShare = p->pShare;
+    if ( pShare == NULL )
+        return;
+    Saig_Bmc3ParLock();
+    if ( f < pShare->iFrameBest || (f == pShare->iFrameBest && i < pShare->iOutBest) )
+    {
+        pShare->iFrameBest = f;
+        pShare->iOutBest   = i;
+        pShare->iWinner    = p->iWorker;
+        pShare->fCexBest   = fCex;
+    }
+    Saig_Bmc3ParUnlock();
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bounded model checking engine.]
+
+  Description [When pShare is not NULL, this is one of the concurrent
+  workers, which solves only the pairs (frame, output) it owns.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcScalableInt( Aig_Man_t * pAig, Saig_ParBmc_t * pPars, Saig_Bmc3Par_t * pShare, int iWorker )
 {
     Gia_ManBmc_t * p;
     Aig_Obj_t * pObj;
@@ -1467,7 +1714,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     unsigned * pInfo;
     int RetValue = -1, fFirst = 1, nJumpFrame = 0, fUnfinished = 0;
     int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pAig) );
-    int i, f, k, Lit, status;
+    int i = 0, f, k, Lit, status;
     abctime clk, clk2, clkSatRun, clkOther = 0, clkTotal = Abc_Clock();
     abctime nTimeUnsat = 0, nTimeSat = 0, nTimeUndec = 0, clkOne = 0;
     abctime nTimeToStopNG, nTimeToStop;
@@ -1482,6 +1729,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     // create BMC manager
     p = Saig_Bmc3ManStart( pAig, pPars->nTimeOutOne, pPars->nConfLimit, pPars->fUseSatoko, pPars->fUseGlucose );
     p->pPars = pPars;
+    p->pShare = pShare;
+    p->iWorker = iWorker;
     if ( p->pSat )
     {
         p->pSat->nLearntStart = p->pPars->nLearnedStart;
@@ -1531,7 +1780,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         // stop BMC after exploring all reachable states
         if ( !pPars->nFramesJump && Aig_ManRegNum(pAig) < 30 && f == (1 << Aig_ManRegNum(pAig)) )
         {
-            Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
+            if ( p->iWorker == 0 && !pPars->fSilent )
+                Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
             if ( p->pPars->fUseBridge )
                 Saig_ManForEachPo( pAig, pObj, i )
                     if ( !(p->vCexes && Vec_PtrEntry(p->vCexes, i)) && !(p->pTime4Outs && p->pTime4Outs[i] == 0) ) // not SAT and not timed out
@@ -1549,6 +1799,9 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         // consider the next timeframe
         if ( (RetValue == -1 || pPars->fSolveAll) && pPars->nStart == 0 && !nJumpFrame )
             pPars->iFrame = f-1;
+        // stop if another worker has stopped in an earlier frame
+        if ( Saig_Bmc3ParIsDone( p, f ) )
+            goto finish;
         // map nodes of this section
         Vec_PtrPush( p->vId2Var, Vec_IntStartFull(p->nObjNums) );
         Vec_PtrPush( p->vTerInfo, (pInfo = ABC_CALLOC(unsigned, p->nWordNum)) );
@@ -1638,6 +1891,9 @@ clkOther += Abc_Clock() - clk2;
             // skip output whose time has run out
             if ( p->pTime4Outs && p->pTime4Outs[i] == 0 )
                 continue;
+            // skip output owned by another worker
+            if ( !Saig_Bmc3ParOwns( p, f, i ) )
+                continue;
             // add constraints for this output
 clk2 = Abc_Clock();
             Lit = Saig_ManBmcCreateCnf( p, pObj, f );
@@ -1701,12 +1957,16 @@ nTimeUnsat += clkSatRun;
                 }
                 if ( p->pPars->fUseBridge )
                     Gia_ManReportProgress( stdout, i, f );
+                if ( p->pPars->pFuncOnFrameDone )
+                    p->pPars->pFuncOnFrameDone( p->pPars->RunId, f, i, 0 );
             }
             else if ( status == l_True )
             {
 nTimeSat += clkSatRun;
                 RetValue = 0;
                 fFirst = 0;
+                if ( p->pPars->pFuncOnFrameDone )
+                    p->pPars->pFuncOnFrameDone( p->pPars->RunId, f, i, 1 );
                 if ( !pPars->fSolveAll )
                 {
                     if ( pPars->fVerbose )
@@ -1719,8 +1979,9 @@ nTimeSat += clkSatRun;
 //                        Abc_Print( 1, "Uni =%7.0f. ",(double)(p->pSat ? sat_solver_count_assigned(p->pSat) : 0) );
 //                        ABC_PRT( "Time", Abc_Clock() - clk );
                         Abc_Print( 1, "Learn =%7.0f. ", (double)(p->pSat ? p->pSat->stats.learnts : p->pSat3 ? bmcg_sat_solver_learntnum(p->pSat3) : satoko_learntnum(p->pSat2)) );
-                        Abc_Print( 1, "%4.0f MB",      4.25*(f+1)*p->nObjNums /(1<<20) );
+                        Abc_Print( 1, "%4.0f MB",      Saig_ManBmcFrameMemory(p) /(1<<20) );
                         Abc_Print( 1, "%4.0f MB",      1.0*(p->pSat ? sat_solver_memory(p->pSat) : 0)/(1<<20) );
+                        Abc_Print( 1, "%6.0f KB/f",    (Saig_ManBmcFrameMemory(p) + (p->pSat ? sat_solver_memory(p->pSat) : 0))/(f+1)/(1<<10) );
                         Abc_Print( 1, "%9.2f sec  ",   (float)(Abc_Clock() - clkTotal)/(float)(CLOCKS_PER_SEC) );
 //                        Abc_Print( 1, "\n" );
 //                        ABC_PRMn( "Id2Var", (f+1)*p->nObjNums*4 );
@@ -1732,6 +1993,7 @@ nTimeSat += clkSatRun;
                     }
                     ABC_FREE( pAig->pSeqModel );
                     pAig->pSeqModel = Saig_ManGenerateCex( p, f, i );
+                    Saig_Bmc3ParReport( p, f, i, 1 );
                     goto finish;
                 }
                 pPars->nFailOuts++;
@@ -1831,6 +2093,9 @@ nTimeUndec += clkSatRun;
                     goto finish;
             }
         }
+        // compact the timeframes that will not be extended
+        if ( pPars->fCompactFrames )
+            Saig_ManBmcCompactFrames( p, f );
         if ( pPars->fVerbose ) 
         {
             if ( fFirst == 1 && f > 0 && (p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) > 1 )
@@ -1852,8 +2117,9 @@ nTimeUndec += clkSatRun;
                 Abc_Print( 1, "T/O =%4d. ", pPars->nDropOuts );
 //            ABC_PRT( "Time", Abc_Clock() - clk );
 //            Abc_Print( 1, "%4.0f MB",     4.0*Vec_IntSize(p->vVisited) /(1<<20) );
-            Abc_Print( 1, "%4.0f MB",     4.0*(f+1)*p->nObjNums /(1<<20) );
+            Abc_Print( 1, "%4.0f MB",     Saig_ManBmcFrameMemory(p) /(1<<20) );
             Abc_Print( 1, "%4.0f MB",     1.0*(p->pSat ? sat_solver_memory(p->pSat) : 0)/(1<<20) );
+            Abc_Print( 1, "%6.0f KB/f",   (Saig_ManBmcFrameMemory(p) + (p->pSat ? sat_solver_memory(p->pSat) : 0))/(f+1)/(1<<10) );
 //            Abc_Print( 1, " %6d %6d ",   p->nLitUsed, p->nLitUseless );
             Abc_Print( 1, "%9.2f sec ",   1.0*(Abc_Clock() - clkTotal)/CLOCKS_PER_SEC );
 //            Abc_Print( 1, "\n" );
@@ -1872,6 +2138,9 @@ nTimeUndec += clkSatRun;
         pPars->iFrame = f-1;
 //ABC_PRT( "CNF generation runtime", clkOther );
 finish:
+    // let other workers skip the pairs following the undecided one
+    if ( RetValue == -1 )
+        Saig_Bmc3ParReport( p, f, i, 0 );
     if ( pPars->fVerbose )
     {
         Abc_Print( 1, "Runtime:  " );
@@ -1888,6 +2157,151 @@ finish:
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Runs the concurrent BMC workers.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+void * Saig_ManBmcWorkerThread( void * pArg )
+{
+    Saig_Bmc3ThData_t * pThData = (Saig_Bmc3ThData_t *)pArg;
+    pThData->RetValue = Saig_ManBmcScalableInt( pThData->pAig, pThData->pPars, pThData->pShare, pThData->iWorker );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+void Saig_ManBmcRunWorkers( Saig_Bmc3ThData_t * pThData, int nProcs )
+{
+    pthread_t WorkerThread[BMC3_THR_MAX];
+    int i, status;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Saig_ManBmcWorkerThread, (void *)(pThData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+}
+
+#else
+
+void Saig_ManBmcRunWorkers( Saig_Bmc3ThData_t * pThData, int nProcs )
+{
+    int i;
+    for ( i = 0; i < nProcs; i++ )
+        pThData[i].RetValue = Saig_ManBmcScalableInt( pThData[i].pAig, pThData[i].pPars, pThData[i].pShare, pThData[i].iWorker );
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Concurrent bounded model checking engine.]
+
+  Description [Each worker has its own incremental SAT solver and its own
+  copy of the AIG, because CNF generation updates traversal IDs of the
+  AIG nodes. When there are enough outputs, the outputs are distributed
+  among the workers; otherwise, the timeframes are distributed. The CEX
+  returned is the same as the one found by the sequential engine.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    Saig_Bmc3ThData_t ThData[BMC3_THR_MAX];
+    Saig_ParBmc_t * pParsAll;
+    Saig_Bmc3Par_t Share, * pShare = &Share;
+    int i, RetValue, nProcs = Abc_MinInt( pPars->nProcs, BMC3_THR_MAX );
+    assert( !pPars->fSolveAll );
+    memset( pShare, 0, sizeof(Saig_Bmc3Par_t) );
+    pShare->nWorkers   = nProcs;
+    pShare->fByFrames  = Saig_ManPoNum(pAig) < nProcs;
+    pShare->iFrameBest = ABC_INFINITY;
+    pShare->iOutBest   = ABC_INFINITY;
+    pShare->iWinner    = -1;
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Running %d workers on interleaved %s.\n", nProcs, pShare->fByFrames ? "timeframes" : "outputs" );
+    // only the first worker prints its progress
+    pParsAll = ABC_ALLOC( Saig_ParBmc_t, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pParsAll[i] = *pPars;
+        pParsAll[i].nProcs      = 1;
+        pParsAll[i].fUseBridge  = 0;
+        if ( i > 0 )
+        {
+            pParsAll[i].fVerbose     = 0;
+            pParsAll[i].fNotVerbose  = 1;
+            pParsAll[i].fSilent      = 1;
+            pParsAll[i].pLogFileName = NULL;
+        }
+        ThData[i].pAig     = Aig_ManDupSimple( pAig );
+        ThData[i].pPars    = pParsAll + i;
+        ThData[i].pShare   = pShare;
+        ThData[i].iWorker  = i;
+        ThData[i].RetValue = -1;
+    }
+    Saig_ManBmcRunWorkers( ThData, nProcs );
+    // collect the results
+    if ( pShare->iWinner >= 0 && pShare->fCexBest )
+    {
+        Aig_Man_t * pAigWin = ThData[pShare->iWinner].pAig;
+        ABC_FREE( pAig->pSeqModel );
+        pAig->pSeqModel = pAigWin->pSeqModel;
+        pAigWin->pSeqModel = NULL;
+        pPars->iFrame = pShare->iFrameBest - 1;
+        RetValue = 0;
+    }
+    else
+    {
+        RetValue = 1;
+        pPars->iFrame = ABC_INFINITY;
+        for ( i = 0; i < nProcs; i++ )
+        {
+            if ( ThData[i].RetValue != 1 )
+                RetValue = -1;
+            pPars->iFrame = Abc_MinInt( pPars->iFrame, pParsAll[i].iFrame );
+        }
+    }
+    pPars->nFramesMax = pParsAll[0].nFramesMax;
+    for ( i = 0; i < nProcs; i++ )
+        Aig_ManStop( ThData[i].pAig );
+    ABC_FREE( pParsAll );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bounded model checking engine.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    if ( pPars->nProcs > 1 && !pPars->fSolveAll )
+        return Saig_ManBmcScalablePar( pAig, pPars );
+    return Saig_ManBmcScalableInt( pAig, pPars, NULL, 0 );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
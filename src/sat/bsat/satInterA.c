@@ -1037,6 +1037,52 @@ p->timeTotal += Abc_Clock() - clkTotal;
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Collects learned clauses implied by the clauses of B.]
+
+  Description [Should be called after Inta_ManInterpolate() returned 
+  interpolant pInter. If the partial interpolant of a learned clause is 
+  constant 1, the clause without the literals of A-local variables is 
+  implied by the clauses of B alone, so it can be added to B when solving 
+  another problem with the same B. Assumes that the variables of B are 
+  numbered from 0 to nVarsB-1. Collects such clauses with at most nLitsMax 
+  literals in vLemmas, each as the number of literals followed by the 
+  literals. Returns the number of clauses collected.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inta_ManCollectLemmasB( Inta_Man_t * p, void * pInter, int nVarsB, int nLitsMax, void * vLemmas )
+{
+    Vec_Int_t * vRes = (Vec_Int_t *)vLemmas;
+    Sto_Cls_t * pClause;
+    int v, iStart, nLits, Counter = 0;
+    Sto_ManForEachClause( p->pCnf, pClause )
+    {
+        if ( pClause->fRoot || pClause->nLits == 0 )
+            continue;
+        if ( *Inta_ManAigRead(p, pClause) != Aig_ManConst1((Aig_Man_t *)pInter) )
+            continue;
+        iStart = Vec_IntSize( vRes );
+        Vec_IntPush( vRes, 0 );
+        for ( v = 0; v < (int)pClause->nLits; v++ )
+            if ( lit_var(pClause->pLits[v]) < nVarsB )
+                Vec_IntPush( vRes, pClause->pLits[v] );
+        nLits = Vec_IntSize(vRes) - iStart - 1;
+        if ( nLits == 0 || nLits > nLitsMax )
+        {
+            Vec_IntShrink( vRes, iStart );
+            continue;
+        }
+        Vec_IntWriteEntry( vRes, iStart, nLits );
+        Counter++;
+    }
+    return Counter;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
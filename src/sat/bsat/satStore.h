@@ -131,6 +131,7 @@ typedef struct Inta_Man_t_ Inta_Man_t;
 extern Inta_Man_t * Inta_ManAlloc();
 extern void         Inta_ManFree( Inta_Man_t * p );
 extern void *       Inta_ManInterpolate( Inta_Man_t * p, Sto_Man_t * pCnf, abctime TimeToStop, void * vVarsAB, int fVerbose );
+extern int          Inta_ManCollectLemmasB( Inta_Man_t * p, void * pInter, int nVarsB, int nLitsMax, void * vLemmas );
 
 /*=== satInterB.c ==========================================================*/
 typedef struct Intb_Man_t_ Intb_Man_t;
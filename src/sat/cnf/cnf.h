@@ -51,6 +51,8 @@ ABC_NAMESPACE_HEADER_START
 typedef struct Cnf_Man_t_            Cnf_Man_t;
 typedef struct Cnf_Dat_t_            Cnf_Dat_t;
 typedef struct Cnf_Cut_t_            Cnf_Cut_t;
+typedef struct Cnf_Wrt_t_            Cnf_Wrt_t;
+typedef struct Cnf_Rdr_t_            Cnf_Rdr_t;
 
 // the CNF asserting outputs of AIG to be 1
 struct Cnf_Dat_t_
@@ -129,6 +131,7 @@ static inline void         Cnf_ObjSetBestCut( Aig_Obj_t * pObj, Cnf_Cut_t * pCut
 extern Vec_Int_t *     Cnf_DeriveMappingArray( Aig_Man_t * pAig );
 extern Cnf_Dat_t *     Cnf_Derive( Aig_Man_t * pAig, int nOutputs );
 extern Cnf_Dat_t *     Cnf_DeriveWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int nOutputs );
+extern int             Cnf_DeriveToFile( Aig_Man_t * pAig, int nOutputs, int fChangePol, char * pFileName, int * pnVars, int * pnClauses, int * pnLiterals );
 extern Cnf_Dat_t *     Cnf_DeriveOther( Aig_Man_t * pAig, int fSkipTtMin );
 extern Cnf_Dat_t *     Cnf_DeriveOtherWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int fSkipTtMin );
 extern void            Cnf_ManPrepare();
@@ -173,6 +176,20 @@ extern int             Cnf_ManMapForCnf( Cnf_Man_t * p );
 extern void            Cnf_ManTransferCuts( Cnf_Man_t * p );
 extern void            Cnf_ManFreeCuts( Cnf_Man_t * p );
 extern void            Cnf_ManPostprocess( Cnf_Man_t * p );
+/*=== cnfStream.c ========================================================*/
+extern Cnf_Wrt_t *     Cnf_WrtStart( char * pFileName );
+extern int             Cnf_WrtStop( Cnf_Wrt_t * p );
+extern void            Cnf_WrtString( Cnf_Wrt_t * p, char * pStr );
+extern void            Cnf_WrtInt( Cnf_Wrt_t * p, int Num );
+extern void            Cnf_WrtHeader( Cnf_Wrt_t * p, int nVars, int nClauses );
+extern void            Cnf_WrtClause( Cnf_Wrt_t * p, int * pBeg, int * pEnd, int fReadable );
+extern Cnf_Rdr_t *     Cnf_RdrStart( char * pFileName );
+extern void            Cnf_RdrStop( Cnf_Rdr_t * p );
+extern int             Cnf_RdrVarNum( Cnf_Rdr_t * p );
+extern int             Cnf_RdrClauseNum( Cnf_Rdr_t * p );
+extern int             Cnf_RdrClauseRead( Cnf_Rdr_t * p );
+extern word            Cnf_RdrLitRead( Cnf_Rdr_t * p );
+extern int             Cnf_RdrNextClause( Cnf_Rdr_t * p, Vec_Int_t * vLits );
 /*=== cnfUtil.c ========================================================*/
 extern Vec_Ptr_t *     Aig_ManScanMapping( Cnf_Man_t * p, int fCollect );
 extern Vec_Ptr_t *     Cnf_ManScanMapping( Cnf_Man_t * p, int fCollect, int fPreorder );
@@ -184,6 +201,7 @@ extern Cnf_Dat_t *     Cnf_DataReadFromFile( char * pFileName );
 extern Vec_Int_t *     Cnf_ManWriteCnfMapping( Cnf_Man_t * p, Vec_Ptr_t * vMapped );
 extern void            Cnf_SopConvertToVector( char * pSop, int nCubes, Vec_Int_t * vCover );
 extern Cnf_Dat_t *     Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs );
+extern void            Cnf_ManWriteCnfStream( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int fChangePol, Cnf_Wrt_t * pWrt, int * pnVars, int * pnClauses, int * pnLiterals );
 extern Cnf_Dat_t *     Cnf_ManWriteCnfOther( Cnf_Man_t * p, Vec_Ptr_t * vMapped );
 extern Cnf_Dat_t *     Cnf_DeriveSimple( Aig_Man_t * p, int nOutputs );
 extern Cnf_Dat_t *     Cnf_DeriveSimpleForRetiming( Aig_Man_t * p );
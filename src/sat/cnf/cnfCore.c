@@ -167,6 +167,57 @@ Cnf_Dat_t * Cnf_Derive( Aig_Man_t * pAig, int nOutputs )
     Cnf_ManPrepare();
     return Cnf_DeriveWithMan( s_pManCnf, pAig, nOutputs );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Converts AIG into CNF and writes it into a DIMACS file.]
+
+  Description [Streams the clauses into the file without collecting
+  them in memory. The file is gzip-compressed if its name ends with
+  ".gz". Returns 1 on success.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_DeriveToFile( Aig_Man_t * pAig, int nOutputs, int fChangePol, char * pFileName, int * pnVars, int * pnClauses, int * pnLiterals )
+{
+    Cnf_Man_t * p;
+    Cnf_Wrt_t * pWrt;
+    Vec_Ptr_t * vMapped;
+    Aig_MmFixed_t * pMemCuts;
+    abctime clk;
+    pWrt = Cnf_WrtStart( pFileName );
+    if ( pWrt == NULL )
+        return 0;
+    Cnf_ManPrepare();
+    p = s_pManCnf;
+    p->pManAig = pAig;
+
+    // generate cuts for all nodes, assign cost, and find best cuts
+clk = Abc_Clock();
+    pMemCuts = Dar_ManComputeCuts( pAig, 10, 0, 0 );
+p->timeCuts = Abc_Clock() - clk;
+
+    // find the mapping
+clk = Abc_Clock();
+    Cnf_DeriveMapping( p );
+p->timeMap = Abc_Clock() - clk;
+
+    // write CNF into the file
+clk = Abc_Clock();
+    Cnf_ManTransferCuts( p );
+    vMapped = Cnf_ManScanMapping( p, 1, 1 );
+    Cnf_ManWriteCnfStream( p, vMapped, nOutputs, fChangePol, pWrt, pnVars, pnClauses, pnLiterals );
+    Vec_PtrFree( vMapped );
+    Aig_MmFixedStop( pMemCuts, 0 );
+p->timeSave = Abc_Clock() - clk;
+
+   // reset reference counters
+    Aig_ManResetRefs( pAig );
+    return Cnf_WrtStop( pWrt );
+}
  
 /**Function*************************************************************
 
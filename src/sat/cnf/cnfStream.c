@@ -0,0 +1,406 @@
+/**CFile****************************************************************
+
+  FileName    [cnfStream.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [AIG-to-CNF conversion.]
+
+  Synopsis    [Buffered streaming DIMACS writer and reader.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - April 28, 2007.]
+
+  Revision    [$Id: cnfStream.c,v 1.00 2007/04/28 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "cnf.h"
+#include "misc/zlib/zlib.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define CNF_STREAM_BUF  (1 << 20)   // the size of the I/O buffer
+#define CNF_STREAM_LINE 32          // the longest token written at once
+
+// buffered DIMACS writer (plain or gzip-compressed)
+struct Cnf_Wrt_t_
+{
+    FILE *          pFile;           // the plain output file
+    gzFile          pGzip;           // the compressed output file
+    char *          pBuf;            // the output buffer
+    int             nBuf;            // the number of bytes in the buffer
+    int             fError;          // set if a write has failed
+};
+
+// buffered DIMACS reader (the input may be gzip-compressed)
+struct Cnf_Rdr_t_
+{
+    gzFile          pFile;           // the input file
+    char *          pFileName;       // the input file name
+    char *          pBuf;            // the input buffer
+    int             nBuf;            // the number of bytes in the buffer
+    int             iBuf;            // the current position in the buffer
+    int             iLine;           // the current line
+    int             cLast;           // the character following the last integer
+    int             nVars;           // the number of variables from the header
+    int             nClauses;        // the number of clauses from the header
+    int             nClausesRead;    // the number of clauses read so far
+    word            nLitsRead;       // the number of literals read so far
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the buffered DIMACS writer.]
+
+  Description [The output is compressed when the file name ends
+  with ".gz". Returns NULL if the file cannot be opened.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Wrt_t * Cnf_WrtStart( char * pFileName )
+{
+    Cnf_Wrt_t * p;
+    int nLen = strlen(pFileName);
+    p = ABC_CALLOC( Cnf_Wrt_t, 1 );
+    if ( nLen > 3 && !strcmp(pFileName+nLen-3, ".gz") )
+        p->pGzip = gzopen( pFileName, "wb" );
+    else
+        p->pFile = fopen( pFileName, "wb" );
+    if ( p->pFile == NULL && p->pGzip == NULL )
+    {
+        printf( "Cnf_WrtStart(): Output file \"%s\" cannot be opened.\n", pFileName );
+        ABC_FREE( p );
+        return NULL;
+    }
+    p->pBuf = ABC_ALLOC( char, CNF_STREAM_BUF );
+    return p;
+}
+static void Cnf_WrtFlush( Cnf_Wrt_t * p )
+{
+    if ( p->nBuf == 0 )
+        return;
+    if ( p->pGzip )
+    {
+        if ( gzwrite( p->pGzip, p->pBuf, (unsigned)p->nBuf ) != p->nBuf )
+            p->fError = 1;
+    }
+    else if ( fwrite( p->pBuf, 1, (size_t)p->nBuf, p->pFile ) != (size_t)p->nBuf )
+        p->fError = 1;
+    p->nBuf = 0;
+}
+int Cnf_WrtStop( Cnf_Wrt_t * p )
+{
+    int RetValue;
+    Cnf_WrtFlush( p );
+    if ( p->pGzip && gzclose( p->pGzip ) != Z_OK )
+        p->fError = 1;
+    if ( p->pFile && fclose( p->pFile ) != 0 )
+        p->fError = 1;
+    if ( p->fError )
+        printf( "Cnf_WrtStop(): Writing the output file has failed.\n" );
+    RetValue = !p->fError;
+    ABC_FREE( p->pBuf );
+    ABC_FREE( p );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes strings and integers into the buffer.]
+
+  Description [Cnf_WrtInt() writes the integer followed by a space.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_WrtString( Cnf_Wrt_t * p, char * pStr )
+{
+    int nLen = strlen(pStr), nPart;
+    while ( nLen > 0 )
+    {
+        if ( p->nBuf == CNF_STREAM_BUF )
+            Cnf_WrtFlush( p );
+        nPart = Abc_MinInt( nLen, CNF_STREAM_BUF - p->nBuf );
+        memcpy( p->pBuf + p->nBuf, pStr, (size_t)nPart );
+        p->nBuf += nPart;
+        pStr += nPart;
+        nLen -= nPart;
+    }
+}
+static inline void Cnf_WrtIntInt( Cnf_Wrt_t * p, int Num )
+{
+    char Digits[16], * pOut = p->pBuf + p->nBuf;
+    unsigned uNum = Num < 0 ? 0 - (unsigned)Num : (unsigned)Num;
+    int nDigits = 0;
+    if ( Num < 0 )
+        *pOut++ = '-';
+    do Digits[nDigits++] = '0' + (char)(uNum % 10), uNum /= 10; while ( uNum );
+    while ( nDigits )
+        *pOut++ = Digits[--nDigits];
+    *pOut++ = ' ';
+    p->nBuf = pOut - p->pBuf;
+}
+void Cnf_WrtInt( Cnf_Wrt_t * p, int Num )
+{
+    if ( p->nBuf + CNF_STREAM_LINE > CNF_STREAM_BUF )
+        Cnf_WrtFlush( p );
+    Cnf_WrtIntInt( p, Num );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the DIMACS header.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_WrtHeader( Cnf_Wrt_t * p, int nVars, int nClauses )
+{
+    char Buffer[100];
+    Cnf_WrtString( p, "c Result of efficient AIG-to-CNF conversion using package CNF\n" );
+    sprintf( Buffer, "p cnf %d %d\n", nVars, nClauses );
+    Cnf_WrtString( p, Buffer );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes one clause given as an array of literals.]
+
+  Description [If fReadable is 0, variables are incremented by one,
+  as required by DIMACS.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_WrtClause( Cnf_Wrt_t * p, int * pBeg, int * pEnd, int fReadable )
+{
+    int * pLit;
+    for ( pLit = pBeg; pLit < pEnd; pLit++ )
+    {
+        if ( p->nBuf + CNF_STREAM_LINE > CNF_STREAM_BUF )
+            Cnf_WrtFlush( p );
+        if ( fReadable )
+            Cnf_WrtIntInt( p, Abc_LitIsCompl(*pLit) ? -Abc_Lit2Var(*pLit) : Abc_Lit2Var(*pLit) );
+        else
+            Cnf_WrtIntInt( p, Abc_LitIsCompl(*pLit) ? -Abc_Lit2Var(*pLit)-1 : Abc_Lit2Var(*pLit)+1 );
+    }
+    if ( p->nBuf + CNF_STREAM_LINE > CNF_STREAM_BUF )
+        Cnf_WrtFlush( p );
+    p->pBuf[p->nBuf++] = '0';
+    p->pBuf[p->nBuf++] = '\n';
+}
+
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the next character of the input.]
+
+  Description [Returns -1 at the end of the file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_RdrRefill( Cnf_Rdr_t * p )
+{
+    p->iBuf = 0;
+    p->nBuf = gzread( p->pFile, p->pBuf, CNF_STREAM_BUF );
+    if ( p->nBuf <= 0 )
+    {
+        p->nBuf = 0;
+        return -1;
+    }
+    return (unsigned char)p->pBuf[p->iBuf++];
+}
+static inline int Cnf_RdrChar( Cnf_Rdr_t * p )
+{
+    if ( p->iBuf < p->nBuf )
+        return (unsigned char)p->pBuf[p->iBuf++];
+    return Cnf_RdrRefill( p );
+}
+static inline int Cnf_RdrCharSkipSpace( Cnf_Rdr_t * p )
+{
+    int c;
+    while ( (c = Cnf_RdrChar(p)) == ' ' || c == '\t' || c == '\r' || c == '\n' )
+        if ( c == '\n' )
+            p->iLine++;
+    return c;
+}
+static void Cnf_RdrSkipLine( Cnf_Rdr_t * p )
+{
+    int c;
+    while ( (c = Cnf_RdrChar(p)) != -1 && c != '\n' );
+    p->iLine++;
+}
+// reads an integer starting with character c; returns 0 if there are no digits
+static int Cnf_RdrInt( Cnf_Rdr_t * p, int c, int * pNum )
+{
+    int fNeg = 0, fDigit = 0;
+    unsigned uNum = 0;
+    if ( c == '-' )
+        fNeg = 1, c = Cnf_RdrChar(p);
+    else if ( c == '+' )
+        c = Cnf_RdrChar(p);
+    for ( ; c >= '0' && c <= '9'; c = Cnf_RdrChar(p) )
+        uNum = 10 * uNum + (unsigned)(c - '0'), fDigit = 1;
+    p->cLast = c;
+    if ( c == '\n' )
+        p->iLine++;
+    else if ( c != -1 && c != ' ' && c != '\t' && c != '\r' )
+        return 0;
+    *pNum = fNeg ? -(int)uNum : (int)uNum;
+    return fDigit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the streaming DIMACS reader.]
+
+  Description [Opens the file, which may be gzip-compressed, and
+  reads the comments and the "p cnf" line. Returns NULL on failure.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Rdr_t * Cnf_RdrStart( char * pFileName )
+{
+    Cnf_Rdr_t * p;
+    gzFile pFile = gzopen( pFileName, "rb" );
+    int c, k;
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for reading.\n", pFileName );
+        return NULL;
+    }
+    p = ABC_CALLOC( Cnf_Rdr_t, 1 );
+    p->pFile     = pFile;
+    p->pFileName = pFileName;
+    p->pBuf      = ABC_ALLOC( char, CNF_STREAM_BUF );
+    p->iLine     = 1;
+    p->nVars     = -1;
+    while ( (c = Cnf_RdrCharSkipSpace(p)) == 'c' )
+        Cnf_RdrSkipLine( p );
+    if ( c == 'p' )
+    {
+        c = Cnf_RdrCharSkipSpace( p );
+        for ( k = 0; k < 3 && c == "cnf"[k]; k++ )
+            c = Cnf_RdrChar( p );
+        if ( k == 3 && (c == ' ' || c == '\t') &&
+             Cnf_RdrInt( p, Cnf_RdrCharSkipSpace(p), &p->nVars ) &&
+             Cnf_RdrInt( p, Cnf_RdrCharSkipSpace(p), &p->nClauses ) )
+        {
+            if ( p->cLast != '\n' )
+                Cnf_RdrSkipLine( p );
+            if ( p->nVars > 0 && p->nClauses > 0 )
+                return p;
+            printf( "Incorrect parameters.\n" );
+        }
+        else
+            printf( "Incorrect input file.\n" );
+    }
+    else
+        printf( "There is no parameter line in file \"%s\".\n", pFileName );
+    Cnf_RdrStop( p );
+    return NULL;
+}
+void Cnf_RdrStop( Cnf_Rdr_t * p )
+{
+    gzclose( p->pFile );
+    ABC_FREE( p->pBuf );
+    ABC_FREE( p );
+}
+int Cnf_RdrVarNum( Cnf_Rdr_t * p )     { return p->nVars;        }
+int Cnf_RdrClauseNum( Cnf_Rdr_t * p )  { return p->nClauses;     }
+int Cnf_RdrClauseRead( Cnf_Rdr_t * p ) { return p->nClausesRead; }
+word Cnf_RdrLitRead( Cnf_Rdr_t * p )   { return p->nLitsRead;    }
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the next clause.]
+
+  Description [Returns the clause in vLits as ABC literals (2*var+compl,
+  zero-based variables). Returns 1 if a clause was read, 0 at the end
+  of the file, and -1 on a parse error.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_RdrNextClause( Cnf_Rdr_t * p, Vec_Int_t * vLits )
+{
+    int c, Var;
+    Vec_IntClear( vLits );
+    while ( 1 )
+    {
+        c = Cnf_RdrCharSkipSpace( p );
+        if ( c == -1 || (c == '%' && Vec_IntSize(vLits) == 0) )
+        {
+            if ( Vec_IntSize(vLits) == 0 )
+            {
+                if ( p->nClausesRead != p->nClauses )
+                    printf( "Warning! The number of clauses (%d) is different from declaration (%d).\n", p->nClausesRead, p->nClauses );
+                return 0;
+            }
+            printf( "There is no zero-terminator in line %d.\n", p->iLine );
+            return -1;
+        }
+        if ( c == 'c' )
+        {
+            Cnf_RdrSkipLine( p );
+            continue;
+        }
+        if ( !Cnf_RdrInt( p, c, &Var ) )
+        {
+            printf( "Cannot read literal in line %d of file \"%s\".\n", p->iLine, p->pFileName );
+            return -1;
+        }
+        if ( Var == 0 )
+        {
+            p->nClausesRead++;
+            p->nLitsRead += Vec_IntSize(vLits);
+            return 1;
+        }
+        if ( Abc_AbsInt(Var) > p->nVars )
+        {
+            printf( "Literal %d is out-of-bound for %d variables.\n", Var, p->nVars );
+            return -1;
+        }
+        Vec_IntPush( vLits, Var > 0 ? Abc_Var2Lit(Var-1, 0) : Abc_Var2Lit(-Var-1, 1) );
+    }
+    return -1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -303,77 +303,28 @@ unsigned char * Cnf_DataDeriveLitPolarities( Cnf_Dat_t * p )
 ***********************************************************************/
 Cnf_Dat_t * Cnf_DataReadFromFile( char * pFileName )
 {
-    int MaxLine = 1000000;
-    int Var, Lit, nVars = -1, nClas = -1, i, Entry, iLine = 0;
     Cnf_Dat_t * pCnf = NULL;
-    Vec_Int_t * vClas = NULL;
-    Vec_Int_t * vLits = NULL;
-    char * pBuffer, * pToken;
-    FILE * pFile = fopen( pFileName, "rb" );
-    if ( pFile == NULL )
-    {
-        printf( "Cannot open file \"%s\" for writing.\n", pFileName );
+    Cnf_Rdr_t * pRdr;
+    Vec_Int_t * vClas, * vLits, * vClause;
+    int i, Entry, RetValue;
+    pRdr = Cnf_RdrStart( pFileName );
+    if ( pRdr == NULL )
         return NULL;
-    }
-    pBuffer = ABC_ALLOC( char, MaxLine );
-    while ( fgets(pBuffer, MaxLine, pFile) != NULL )
+    vClas   = Vec_IntAlloc( Cnf_RdrClauseNum(pRdr)+1 );
+    vLits   = Vec_IntAlloc( Cnf_RdrClauseNum(pRdr)*8 );
+    vClause = Vec_IntAlloc( 100 );
+    while ( (RetValue = Cnf_RdrNextClause(pRdr, vClause)) == 1 )
     {
-        iLine++;
-        if ( pBuffer[0] == 'c' )
-            continue;
-        if ( pBuffer[0] == 'p' )
-        {
-            pToken = strtok( pBuffer+1, " \t" );
-            if ( strcmp(pToken, "cnf") )
-            {
-                printf( "Incorrect input file.\n" );
-                goto finish;
-            }
-            pToken = strtok( NULL, " \t" );
-            nVars = atoi( pToken );
-            pToken = strtok( NULL, " \t" );
-            nClas = atoi( pToken );
-            if ( nVars <= 0 || nClas <= 0 )
-            {
-                printf( "Incorrect parameters.\n" );
-                goto finish;
-            }
-            // temp storage
-            vClas = Vec_IntAlloc( nClas+1 );
-            vLits = Vec_IntAlloc( nClas*8 );
-            continue;
-        }
-        pToken = strtok( pBuffer, " \t\r\n" );
-        if ( pToken == NULL )
-            continue;
         Vec_IntPush( vClas, Vec_IntSize(vLits) );
-        while ( pToken )
-        {
-            Var = atoi( pToken );
-            if ( Var == 0 )
-                break;
-            Lit = (Var > 0) ? Abc_Var2Lit(Var-1, 0) : Abc_Var2Lit(-Var-1, 1);
-            if ( Lit >= 2*nVars )
-            {
-                printf( "Literal %d is out-of-bound for %d variables.\n", Lit, nVars );
-                goto finish;
-            }
-            Vec_IntPush( vLits, Lit );
-            pToken = strtok( NULL, " \t\r\n" );
-        }
-        if ( Var != 0 )
-        {
-            printf( "There is no zero-terminator in line %d.\n", iLine );
-            goto finish;
-        }
+        Vec_IntAppend( vLits, vClause );
     }
+    if ( RetValue == -1 )
+        goto finish;
     // finalize
-    if ( Vec_IntSize(vClas) != nClas )
-        printf( "Warning! The number of clauses (%d) is different from declaration (%d).\n", Vec_IntSize(vClas), nClas );
     Vec_IntPush( vClas, Vec_IntSize(vLits) );
     // create
     pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
-    pCnf->nVars     = nVars;
+    pCnf->nVars     = Cnf_RdrVarNum(pRdr);
     pCnf->nClauses  = Vec_IntSize(vClas)-1;
     pCnf->nLiterals = Vec_IntSize(vLits);
     pCnf->pClauses  = ABC_ALLOC( int *, Vec_IntSize(vClas) );
@@ -381,10 +332,10 @@ Cnf_Dat_t * Cnf_DataReadFromFile( char * pFileName )
     Vec_IntForEachEntry( vClas, Entry, i )
         pCnf->pClauses[i] = pCnf->pClauses[0] + Entry;
 finish:
-    fclose( pFile );
-    Vec_IntFreeP( &vClas );
-    Vec_IntFreeP( &vLits );
-    ABC_FREE( pBuffer );
+    Cnf_RdrStop( pRdr );
+    Vec_IntFree( vClas );
+    Vec_IntFree( vLits );
+    Vec_IntFree( vClause );
     return pCnf;
 }
 
@@ -402,22 +353,36 @@ finish:
 int Cnf_DataSolveFromFile( char * pFileName, int nConfLimit, int nLearnedStart, int nLearnedDelta, int nLearnedPerce, int fVerbose, int fShowPattern, int ** ppModel, int nPis )
 {
     abctime clk = Abc_Clock();
-    Cnf_Dat_t * pCnf = Cnf_DataReadFromFile( pFileName );
+    Cnf_Rdr_t * pRdr = Cnf_RdrStart( pFileName );
+    Vec_Int_t * vClause;
     sat_solver * pSat;
-    int i, status, RetValue = -1;
-    if ( pCnf == NULL )
+    int i, nVars, status, RetValue = -1;
+    if ( pRdr == NULL )
         return -1;
-    if ( fVerbose )
+    // stream the clauses into the SAT solver
+    nVars = Cnf_RdrVarNum( pRdr );
+    vClause = Vec_IntAlloc( 100 );
+    pSat = sat_solver_new();
+    sat_solver_setnvars( pSat, nVars );
+    while ( (status = Cnf_RdrNextClause(pRdr, vClause)) == 1 )
+        if ( Vec_IntSize(vClause) == 0 || !sat_solver_addclause( pSat, Vec_IntArray(vClause), Vec_IntLimit(vClause) ) )
+            break;
+    if ( fVerbose && status != -1 )
     {
-        printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d. ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
+        printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8.0f. ", nVars, Cnf_RdrClauseRead(pRdr), (double)Cnf_RdrLitRead(pRdr) );
         Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
     }
-    // convert into SAT solver
-    pSat = (sat_solver *)Cnf_DataWriteIntoSolver( pCnf, 1, 0 );
-    if ( pSat == NULL )
+    Cnf_RdrStop( pRdr );
+    Vec_IntFree( vClause );
+    if ( status == -1 )
+    {
+        sat_solver_delete( pSat );
+        return -1;
+    }
+    if ( status == 1 || !sat_solver_simplify(pSat) )
     {
         printf( "The problem is trivially UNSAT.\n" );
-        Cnf_DataFree( pCnf );
+        sat_solver_delete( pSat );
         return 1;
     }
     if ( nLearnedStart )
@@ -456,15 +421,14 @@ int Cnf_DataSolveFromFile( char * pFileName, int nConfLimit, int nLearnedStart,
     {
         *ppModel = ABC_ALLOC( int, nPis );
         for ( i = 0; i < nPis; i++ )
-            (*ppModel)[i] = sat_solver_var_value( pSat, pCnf->nVars - nPis + i );
+            (*ppModel)[i] = sat_solver_var_value( pSat, nVars - nPis + i );
     }
     if ( RetValue == 0 && fShowPattern )
     {
-        for ( i = 0; i < pCnf->nVars; i++ )
+        for ( i = 0; i < nVars; i++ )
             printf( "%d", sat_solver_var_value(pSat,i) );
         printf( "\n" );
     }
-    Cnf_DataFree( pCnf );
     sat_solver_delete( pSat );
     return RetValue;
 }
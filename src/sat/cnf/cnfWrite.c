@@ -27,6 +27,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+static inline void Cnf_ManStreamFlip( int * pLits, int nLits, unsigned char * pVarPols ) { int i; for ( i = 0; i < nLits; i++ ) pLits[i] ^= pVarPols[Abc_Lit2Var(pLits[i])]; }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -185,29 +187,21 @@ int Cnf_IsopWriteCube( int Cube, int nVars, int * pVars, int * pLiterals )
 
 /**Function*************************************************************
 
-  Synopsis    [Derives CNF for the mapping.]
+  Synopsis    [Counts clauses and literals in the CNF for the mapping.]
 
-  Description [The last argument shows the number of last outputs
-  of the manager, which will not be converted into clauses but the
-  new variables for which will be introduced.]
+  Description [Returns the number of clauses.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
+static int Cnf_ManCountCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int * pnLiterals )
 {
-    int fChangeVariableOrder = 0; // should be set to 0 to improve performance
     Aig_Obj_t * pObj;
-    Cnf_Dat_t * pCnf;
     Cnf_Cut_t * pCut;
-    Vec_Int_t * vCover, * vSopTemp;
-    int OutVar, PoVar, pVars[32], * pLits, ** pClas;
     unsigned uTruth;
-    int i, k, nLiterals, nClauses, Cube, Number;
-
-    // count the number of literals and clauses
+    int i, nLiterals, nClauses;
     nLiterals = 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
     nClauses = 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
     Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
@@ -241,9 +235,37 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
             nLiterals += Cnf_IsopCountLiterals( pCut->vIsop[0], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[0]);
             nClauses += Vec_IntSize(pCut->vIsop[0]);
         }
-//printf( "%d ", nClauses-(1 + Aig_ManCoNum( p->pManAig )) );
     }
-//printf( "\n" );
+    *pnLiterals = nLiterals;
+    return nClauses;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF for the mapping.]
+
+  Description [The last argument shows the number of last outputs
+  of the manager, which will not be converted into clauses but the
+  new variables for which will be introduced.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
+{
+    int fChangeVariableOrder = 0; // should be set to 0 to improve performance
+    Aig_Obj_t * pObj;
+    Cnf_Dat_t * pCnf;
+    Cnf_Cut_t * pCut;
+    Vec_Int_t * vCover, * vSopTemp;
+    int OutVar, PoVar, pVars[32], * pLits, ** pClas;
+    unsigned uTruth;
+    int i, k, nLiterals, nClauses, Cube, Number;
+
+    // count the number of literals and clauses
+    nClauses = Cnf_ManCountCnf( p, vMapped, nOutputs, &nLiterals );
 
     // allocate CNF
     pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
@@ -404,6 +426,138 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Writes CNF for the mapping directly into a DIMACS file.]
+
+  Description [Produces the same clauses as Cnf_ManWriteCnf() with the
+  default variable order but streams them into the writer instead of
+  collecting them in memory. If fChangePol is set, the polarity of the
+  internal variables is adjusted as in Cnf_DataTranformPolarity().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_ManWriteCnfStream( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, int fChangePol, Cnf_Wrt_t * pWrt, int * pnVars, int * pnClauses, int * pnLiterals )
+{
+    Aig_Obj_t * pObj;
+    Cnf_Cut_t * pCut;
+    Vec_Int_t * vCover, * vSopTemp;
+    unsigned char * pVarPols = NULL;
+    int OutVar, PoVar, pVars[32], pLits[33], * pVarNums;
+    unsigned uTruth;
+    int i, k, n, nLits, nVars, nLiterals, nClauses, Cube, Number;
+
+    // count the number of literals and clauses
+    nClauses = Cnf_ManCountCnf( p, vMapped, nOutputs, &nLiterals );
+
+    // assign variables as in Cnf_ManWriteCnf()
+    pVarNums = ABC_FALLOC( int, Aig_ManObjNumMax(p->pManAig) );
+    Number = 1;
+    if ( nOutputs )
+    {
+        if ( Aig_ManRegNum(p->pManAig) == 0 )
+        {
+            assert( nOutputs == Aig_ManCoNum(p->pManAig) );
+            Aig_ManForEachCo( p->pManAig, pObj, i )
+                pVarNums[pObj->Id] = Number++;
+        }
+        else
+        {
+            assert( nOutputs == Aig_ManRegNum(p->pManAig) );
+            Aig_ManForEachLiSeq( p->pManAig, pObj, i )
+                pVarNums[pObj->Id] = Number++;
+        }
+    }
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+        pVarNums[pObj->Id] = Number++;
+    Aig_ManForEachCi( p->pManAig, pObj, i )
+        pVarNums[pObj->Id] = Number++;
+    pVarNums[Aig_ManConst1(p->pManAig)->Id] = Number++;
+    nVars = Number;
+
+    // collect variable polarities
+    if ( fChangePol )
+    {
+        pVarPols = ABC_CALLOC( unsigned char, nVars );
+        Aig_ManForEachObj( p->pManAig, pObj, i )
+            if ( !Aig_ObjIsCo(pObj) && pVarNums[pObj->Id] >= 0 )
+                pVarPols[ pVarNums[pObj->Id] ] = (unsigned char)pObj->fPhase;
+    }
+
+    // write the clauses
+    Cnf_WrtHeader( pWrt, nVars, nClauses );
+    vSopTemp = Vec_IntAlloc( 1 << 16 );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+    {
+        pCut = Cnf_ObjBestCut( pObj );
+        OutVar = pVarNums[ pObj->Id ];
+        for ( k = 0; k < (int)pCut->nFanins; k++ )
+            pVars[k] = pVarNums[ pCut->pFanins[k] ];
+        for ( n = 1; n >= 0; n-- )
+        {
+            // positive polarity of the cut first, then negative
+            if ( pCut->nFanins < 5 )
+            {
+                uTruth = 0xFFFF & (n ? *Cnf_CutTruth(pCut) : ~*Cnf_CutTruth(pCut));
+                Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
+                vCover = vSopTemp;
+            }
+            else
+                vCover = pCut->vIsop[n];
+            Vec_IntForEachEntry( vCover, Cube, k )
+            {
+                pLits[0] = 2 * OutVar + !n;
+                nLits = 1 + Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits + 1 );
+                if ( pVarPols )
+                    Cnf_ManStreamFlip( pLits, nLits, pVarPols );
+                Cnf_WrtClause( pWrt, pLits, pLits + nLits, 0 );
+            }
+        }
+    }
+    Vec_IntFree( vSopTemp );
+
+    // write the constant literal
+    OutVar = pVarNums[ Aig_ManConst1(p->pManAig)->Id ];
+    pLits[0] = 2 * OutVar;
+    if ( pVarPols )
+        Cnf_ManStreamFlip( pLits, 1, pVarPols );
+    Cnf_WrtClause( pWrt, pLits, pLits + 1, 0 );
+
+    // write the output literals
+    Aig_ManForEachCo( p->pManAig, pObj, i )
+    {
+        OutVar = pVarNums[ Aig_ObjFanin0(pObj)->Id ];
+        if ( i < Aig_ManCoNum(p->pManAig) - nOutputs )
+        {
+            pLits[0] = 2 * OutVar + Aig_ObjFaninC0(pObj);
+            if ( pVarPols )
+                Cnf_ManStreamFlip( pLits, 1, pVarPols );
+            Cnf_WrtClause( pWrt, pLits, pLits + 1, 0 );
+        }
+        else
+        {
+            PoVar = pVarNums[ pObj->Id ];
+            for ( n = 0; n < 2; n++ )
+            {
+                pLits[0] = 2 * PoVar + n;
+                pLits[1] = 2 * OutVar + (n ^ !Aig_ObjFaninC0(pObj));
+                if ( pVarPols )
+                    Cnf_ManStreamFlip( pLits, 2, pVarPols );
+                Cnf_WrtClause( pWrt, pLits, pLits + 2, 0 );
+            }
+        }
+    }
+    Cnf_WrtString( pWrt, "\n" );
+    ABC_FREE( pVarPols );
+    ABC_FREE( pVarNums );
+    if ( pnVars )     *pnVars     = nVars;
+    if ( pnClauses )  *pnClauses  = nClauses;
+    if ( pnLiterals ) *pnLiterals = nLiterals;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derives CNF for the mapping.]